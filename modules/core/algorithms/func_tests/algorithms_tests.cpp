@@ -0,0 +1,175 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "core/algorithms/include/algorithms.hpp"
+#include "core/algorithms/include/team.hpp"
+
+namespace {
+
+// more members than cores on small machines, so the regions really interleave
+const std::size_t kMembers = 4;
+
+const std::vector<std::size_t> sizes = {0, 1, 3, 4, 5, 100, 1001, 100000};
+
+const std::vector<ppc::core::Schedule> schedules = {{ppc::core::Schedule::STATIC, 0},
+                                                    {ppc::core::Schedule::STATIC, 7},
+                                                    {ppc::core::Schedule::DYNAMIC, 0},
+                                                    {ppc::core::Schedule::DYNAMIC, 64},
+                                                    {ppc::core::Schedule::GUIDED, 16}};
+
+std::vector<int64_t> random_values(std::size_t n) {
+  std::mt19937 gen(static_cast<unsigned>(n));
+  std::uniform_int_distribution<int64_t> dist(-1000, 1000);
+  std::vector<int64_t> values(n);
+  for (auto& value : values) value = dist(gen);
+  return values;
+}
+
+}  // namespace
+
+TEST(team_tests, check_members_run_together) {
+  ppc::core::Team team(kMembers);
+  std::vector<std::size_t> seen(kMembers, 0);
+  std::vector<std::size_t> after(kMembers, 0);
+  team.run([&](ppc::core::Region& region) {
+    EXPECT_EQ(region.size(), kMembers);
+    seen[region.rank()] = region.rank() + 1;
+    // everybody has written before anybody reads
+    region.barrier();
+    std::size_t sum = 0;
+    for (auto s : seen) sum += s;
+    after[region.rank()] = sum;
+  });
+  for (auto sum : after) EXPECT_EQ(sum, kMembers * (kMembers + 1) / 2);
+}
+
+TEST(team_tests, check_regions_reuse_the_members) {
+  ppc::core::Team team(kMembers);
+  std::vector<std::thread::id> first(kMembers);
+  std::vector<std::thread::id> second(kMembers);
+  team.run([&](ppc::core::Region& region) { first[region.rank()] = std::this_thread::get_id(); });
+  team.run([&](ppc::core::Region& region) { second[region.rank()] = std::this_thread::get_id(); });
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(first[0], std::this_thread::get_id());
+}
+
+TEST(team_tests, check_nested_region_runs_alone) {
+  ppc::core::Team team(kMembers);
+  std::atomic<std::size_t> inner{0};
+  team.run([&](ppc::core::Region&) {
+    team.run([&](ppc::core::Region& region) {
+      EXPECT_EQ(region.size(), 1U);
+      region.barrier();
+      inner++;
+    });
+  });
+  EXPECT_EQ(inner.load(), kMembers);
+}
+
+TEST(team_tests, check_exception_is_rethrown) {
+  ppc::core::Team team(kMembers);
+  EXPECT_THROW(team.run([](ppc::core::Region& region) {
+    if (region.rank() == kMembers - 1) throw std::runtime_error("member failed");
+  }),
+               std::runtime_error);
+  std::atomic<std::size_t> calls{0};
+  team.run([&](ppc::core::Region&) { calls++; });
+  EXPECT_EQ(calls.load(), kMembers);
+}
+
+TEST(team_tests, check_every_wait_policy) {
+  for (auto policy : {ppc::core::WaitPolicy::spinning(), ppc::core::WaitPolicy::yielding(),
+                      ppc::core::WaitPolicy::parking(), ppc::core::WaitPolicy::adaptive()}) {
+    ppc::core::Team team(kMembers, policy);
+    for (int round = 0; round < 10; round++) {
+      std::atomic<std::size_t> calls{0};
+      team.run([&](ppc::core::Region& region) {
+        calls++;
+        region.barrier();
+        EXPECT_EQ(calls.load(), kMembers);
+      });
+      if (round % 3 == 0) std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+  }
+}
+
+TEST(algorithms_tests, check_parallel_for_visits_every_index_once) {
+  ppc::core::Team team(kMembers);
+  for (const auto& schedule : schedules) {
+    for (auto n : sizes) {
+      std::vector<std::atomic<int>> visits(n + 10);
+      ppc::core::parallel_for(10, n + 10, [&](std::size_t i) { visits[i]++; }, schedule, team);
+      for (std::size_t i = 0; i < visits.size(); i++) {
+        ASSERT_EQ(visits[i].load(), i < 10 ? 0 : 1) << "n = " << n << ", kind = " << schedule.kind;
+      }
+    }
+  }
+}
+
+TEST(algorithms_tests, check_parallel_reduce) {
+  ppc::core::Team team(kMembers);
+  for (const auto& schedule : schedules) {
+    for (auto n : sizes) {
+      auto values = random_values(n);
+      auto sum = ppc::core::parallel_reduce(
+          0, n, int64_t{0}, [&](std::size_t i) { return values[i]; }, std::plus<>(), schedule, team);
+      EXPECT_EQ(sum, std::accumulate(values.begin(), values.end(), int64_t{0})) << "n = " << n;
+      auto max = ppc::core::parallel_reduce(
+          0, n, INT64_MIN, [&](std::size_t i) { return values[i]; },
+          [](int64_t x, int64_t y) { return std::max(x, y); }, schedule, team);
+      EXPECT_EQ(max, n == 0 ? INT64_MIN : *std::max_element(values.begin(), values.end()));
+    }
+  }
+}
+
+TEST(algorithms_tests, check_parallel_scan) {
+  ppc::core::Team team(kMembers);
+  for (auto n : sizes) {
+    auto values = random_values(n);
+    std::vector<int64_t> expected(n);
+    std::inclusive_scan(values.begin(), values.end(), expected.begin());
+
+    std::vector<int64_t> out(n);
+    auto end = ppc::core::parallel_scan(values.begin(), values.end(), out.begin(), std::plus<>(), team);
+    EXPECT_EQ(end, out.end());
+    EXPECT_EQ(out, expected) << "n = " << n;
+    // in place
+    ppc::core::parallel_scan(values.begin(), values.end(), values.begin(), std::plus<>(), team);
+    EXPECT_EQ(values, expected) << "n = " << n;
+  }
+}
+
+TEST(algorithms_tests, check_parallel_sort) {
+  // odd member counts leave a run without a partner in some merge rounds
+  for (std::size_t members = 1; members <= 7; members++) {
+    ppc::core::Team odd_team(members);
+    for (auto n : sizes) {
+      auto values = random_values(n);
+      auto expected = values;
+      std::sort(expected.begin(), expected.end(), std::greater<>());
+      ppc::core::parallel_sort(values.begin(), values.end(), std::greater<>(), odd_team);
+      EXPECT_EQ(values, expected) << "n = " << n << ", members = " << members;
+    }
+  }
+}
+
+TEST(algorithms_tests, check_shared_team) {
+  auto& team = ppc::core::Team::instance();
+  EXPECT_EQ(&team, &ppc::core::Team::instance());
+  EXPECT_EQ(team.size(), std::max(std::thread::hardware_concurrency(), 1U));
+  std::vector<int> values = {5, 3, 9, 1};
+  ppc::core::parallel_sort(values.begin(), values.end());
+  EXPECT_EQ(values, std::vector<int>({1, 3, 5, 9}));
+}
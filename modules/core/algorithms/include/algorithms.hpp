@@ -0,0 +1,174 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_ALGORITHMS_HPP_
+#define MODULES_CORE_INCLUDE_ALGORITHMS_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <vector>
+
+#include "core/algorithms/include/team.hpp"
+#include "core/partition/include/partition.hpp"
+
+// Parallel algorithms on the std::thread team of core/algorithms/include/team.hpp,
+// the STL counterparts of the OpenMP and oneTBB loops used in the other
+// backends. Every algorithm runs on Team::instance() unless a team is given.
+
+namespace ppc::core {
+
+// How the iterations of a parallel loop are handed out to the team members
+struct Schedule {
+  enum Kind {
+    // grain 0: one balanced range per member; otherwise ranges of grain
+    // iterations dealt round-robin, as OpenMP schedule(static, grain)
+    STATIC,
+    // ranges of grain iterations (1 for grain 0) claimed by whichever member
+    // is free, for iterations of uneven cost
+    DYNAMIC,
+    // claimed like DYNAMIC, but the ranges shrink from n / size to grain
+    GUIDED
+  } kind = STATIC;
+  std::size_t grain = 0;
+};
+
+namespace detail {
+
+// The ranges of a DYNAMIC or GUIDED schedule and the next one to claim
+struct Chunks {
+  Chunks(std::size_t n, std::size_t members, const Schedule& schedule) {
+    const std::size_t grain = std::max<std::size_t>(schedule.grain, 1);
+    if (schedule.kind == Schedule::DYNAMIC) ranges = grain_partition(n, grain);
+    if (schedule.kind == Schedule::GUIDED) ranges = guided_partition(n, members, grain);
+  }
+
+  std::vector<Range> ranges;
+  std::atomic<std::size_t> next{0};
+};
+
+// Calls body(range) for the ranges of [0, n) the schedule gives this member
+template <class Body>
+void for_each_range(const Region& region, std::size_t n, const Schedule& schedule, Chunks& chunks, const Body& body) {
+  if (schedule.kind != Schedule::STATIC) {
+    for (auto c = chunks.next.fetch_add(1); c < chunks.ranges.size(); c = chunks.next.fetch_add(1)) {
+      body(chunks.ranges[c]);
+    }
+  } else if (schedule.grain == 0) {
+    const Range range = balanced_range(n, region.size(), region.rank());
+    if (range.size() != 0) body(range);
+  } else {
+    const std::size_t count = (n + schedule.grain - 1) / schedule.grain;
+    for (std::size_t c = region.rank(); c < count; c += region.size()) {
+      body(Range{c * schedule.grain, std::min(n, (c + 1) * schedule.grain)});
+    }
+  }
+}
+
+// A per-member value on its own cache line
+template <class T>
+struct alignas(64) Padded {
+  T value;
+};
+
+}  // namespace detail
+
+// Calls body(i) for every i in [begin, end)
+template <class Body>
+void parallel_for(std::size_t begin, std::size_t end, const Body& body, const Schedule& schedule = {},
+                  Team& team = Team::instance()) {
+  if (end <= begin) return;
+  const std::size_t n = end - begin;
+  detail::Chunks chunks(n, team.size(), schedule);
+  team.run([&](Region& region) {
+    detail::for_each_range(region, n, schedule, chunks, [&](const Range& range) {
+      for (std::size_t i = range.begin; i < range.end; i++) body(begin + i);
+    });
+  });
+}
+
+// combine over transform(i) for every i in [begin, end), starting from
+// identity. Every member folds its iterations into a partial of its own, the
+// partials are combined in member order; for floating point results only the
+// STATIC schedule gives the same grouping on every run.
+template <class T, class Transform, class Combine>
+T parallel_reduce(std::size_t begin, std::size_t end, T identity, const Transform& transform, const Combine& combine,
+                  const Schedule& schedule = {}, Team& team = Team::instance()) {
+  if (end <= begin) return identity;
+  const std::size_t n = end - begin;
+  detail::Chunks chunks(n, team.size(), schedule);
+  std::vector<detail::Padded<T>> partial(team.size(), detail::Padded<T>{identity});
+  team.run([&](Region& region) {
+    T acc = identity;
+    detail::for_each_range(region, n, schedule, chunks, [&](const Range& range) {
+      for (std::size_t i = range.begin; i < range.end; i++) acc = combine(acc, transform(begin + i));
+    });
+    partial[region.rank()].value = acc;
+  });
+  T result = identity;
+  for (const auto& p : partial) result = combine(result, p.value);
+  return result;
+}
+
+// Inclusive scan of [first, last) into d_first with the associative op, as
+// std::inclusive_scan; d_first may be first. Every member reduces its
+// balanced block, waits on the barrier, then scans its block starting from
+// the blocks before it. As with the std execution policies, an exception
+// thrown by op terminates the program.
+template <class RandomIt, class OutIt, class Op = std::plus<>>
+OutIt parallel_scan(RandomIt first, RandomIt last, OutIt d_first, const Op& op = {}, Team& team = Team::instance()) {
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  const auto n = static_cast<std::size_t>(last - first);
+  std::vector<detail::Padded<std::optional<T>>> partial(team.size());
+  team.run([&](Region& region) noexcept {
+    const Range block = balanced_range(n, region.size(), region.rank());
+    if (block.size() != 0) {
+      T acc = first[block.begin];
+      for (std::size_t i = block.begin + 1; i < block.end; i++) acc = op(acc, first[i]);
+      partial[region.rank()].value = acc;
+    }
+    region.barrier();
+    std::optional<T> carry;
+    for (std::size_t r = 0; r < region.rank(); r++) {
+      if (const auto& sum = partial[r].value) carry = carry ? op(*carry, *sum) : *sum;
+    }
+    if (block.size() != 0) {
+      T acc = carry ? op(*carry, first[block.begin]) : first[block.begin];
+      d_first[block.begin] = acc;
+      for (std::size_t i = block.begin + 1; i < block.end; i++) {
+        acc = op(acc, first[i]);
+        d_first[i] = acc;
+      }
+    }
+  });
+  return d_first + static_cast<std::ptrdiff_t>(n);
+}
+
+// Sorts [first, last) like std::sort: every member sorts its balanced block,
+// then the sorted runs are merged pairwise, one barrier per round. As with
+// the std execution policies, an exception thrown by comp terminates the
+// program.
+template <class RandomIt, class Compare = std::less<>>
+void parallel_sort(RandomIt first, RandomIt last, const Compare& comp = {}, Team& team = Team::instance()) {
+  const auto n = static_cast<std::size_t>(last - first);
+  team.run([&](Region& region) noexcept {
+    const std::size_t size = region.size();
+    auto at = [&](std::size_t part) {
+      return first + static_cast<std::ptrdiff_t>(part < size ? balanced_range(n, size, part).begin : n);
+    };
+    std::sort(at(region.rank()), at(region.rank() + 1), comp);
+    for (std::size_t step = 1; step < size; step *= 2) {
+      region.barrier();
+      if (region.rank() % (2 * step) == 0 && region.rank() + step < size) {
+        std::inplace_merge(at(region.rank()), at(region.rank() + step), at(std::min(region.rank() + 2 * step, size)),
+                           comp);
+      }
+    }
+  });
+}
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_ALGORITHMS_HPP_
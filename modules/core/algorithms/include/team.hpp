@@ -0,0 +1,102 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_TEAM_HPP_
+#define MODULES_CORE_INCLUDE_TEAM_HPP_
+
+#include <barrier>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <latch>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+#include "core/thread_pool/include/wait_policy.hpp"
+
+namespace ppc::core {
+
+class Team;
+
+// One member's view of a parallel region: its rank, the number of members
+// and the barrier they all pass together
+class Region {
+ public:
+  Region(Team* team, std::size_t rank, std::size_t size) : team_(team), rank_(rank), size_(size) {}
+
+  [[nodiscard]] std::size_t rank() const { return rank_; }
+  [[nodiscard]] std::size_t size() const { return size_; }
+
+  // returns once every member of the region has called it
+  void barrier() const;
+
+ private:
+  Team* team_;
+  std::size_t rank_;
+  std::size_t size_;
+};
+
+// Persistent team of std::jthreads running SPMD regions, like an OpenMP
+// parallel region: every member runs the region body at the same time, so the
+// members may wait for each other on Region::barrier(). The calling thread is
+// member 0; the others wait for the next region as the WaitPolicy of the team
+// says and are stopped through their stop tokens when the team is destroyed.
+class Team {
+ public:
+  // threads members including the caller, at least one
+  explicit Team(std::size_t threads, const WaitPolicy& policy = WaitPolicy::adaptive());
+  ~Team();
+
+  Team(const Team&) = delete;
+  Team& operator=(const Team&) = delete;
+
+  // The team of the STL algorithms, hardware_concurrency() members, started
+  // on first use and kept until the program exits
+  static Team& instance();
+
+  [[nodiscard]] std::size_t size() const { return members_.size() + 1; }
+  [[nodiscard]] const WaitPolicy& wait_policy() const { return policy_; }
+
+  // Runs body(region) on every member and returns when all are done; the
+  // first exception thrown by a body is rethrown. A region started from
+  // inside a region of the same team runs on the calling thread alone.
+  template <class Body>
+  void run(const Body& body) {
+    run([](const void* context, Region& region) { (*static_cast<const Body*>(context))(region); }, &body);
+  }
+
+ private:
+  friend class Region;
+  using Invoke = void (*)(const void*, Region&);
+
+  void run(Invoke invoke, const void* context);
+  void member(const std::stop_token& stop, std::size_t rank);
+  void invoke_member(Invoke invoke, const void* context, std::size_t rank);
+
+  WaitPolicy policy_;
+  // regions started by different threads run one after another
+  std::mutex region_mutex_;
+  std::barrier<> barrier_;
+
+  // the current region, published by bumping generation_ and left alone
+  // until every member has counted down done_
+  WaitWord generation_;
+  Invoke invoke_ = nullptr;
+  const void* context_ = nullptr;
+  std::latch* done_ = nullptr;
+  // the first exception of the region, guarded by error_mutex_
+  std::mutex error_mutex_;
+  std::exception_ptr error_;
+
+  // declared last: the threads stop and join before the state above goes away
+  std::vector<std::jthread> members_;
+};
+
+inline void Region::barrier() const {
+  if (team_ != nullptr && size_ > 1) team_->barrier_.arrive_and_wait();
+}
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_TEAM_HPP_
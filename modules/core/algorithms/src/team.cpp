@@ -0,0 +1,76 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/algorithms/include/team.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace {
+
+// the team whose region runs on this thread, nullptr outside every region
+thread_local const ppc::core::Team* current = nullptr;
+
+}  // namespace
+
+ppc::core::Team::Team(std::size_t threads, const WaitPolicy& policy)
+    : policy_(policy), barrier_(static_cast<std::ptrdiff_t>(std::max<std::size_t>(threads, 1))) {
+  members_.reserve(threads);
+  for (std::size_t rank = 1; rank < threads; rank++) {
+    members_.emplace_back([this, rank](const std::stop_token& stop) { member(stop, rank); });
+  }
+}
+
+ppc::core::Team::~Team() {
+  // parked members only see the stop request once they are woken
+  for (auto& member : members_) member.request_stop();
+  generation_.notify_all();
+}
+
+ppc::core::Team& ppc::core::Team::instance() {
+  static Team team(std::max(std::thread::hardware_concurrency(), 1U));
+  return team;
+}
+
+void ppc::core::Team::run(Invoke invoke, const void* context) {
+  if (members_.empty() || current == this) {
+    Region region(nullptr, 0, 1);
+    invoke(context, region);
+    return;
+  }
+
+  std::lock_guard<std::mutex> region_lock(region_mutex_);
+  std::latch done(static_cast<std::ptrdiff_t>(members_.size()));
+  invoke_ = invoke;
+  context_ = context;
+  done_ = &done;
+  error_ = nullptr;
+  generation_.notify_all();
+  invoke_member(invoke, context, 0);
+  done.wait();
+
+  if (error_) std::rethrow_exception(std::exchange(error_, nullptr));
+}
+
+void ppc::core::Team::invoke_member(Invoke invoke, const void* context, std::size_t rank) {
+  const Team* outer = std::exchange(current, this);
+  Region region(this, rank, size());
+  try {
+    invoke(context, region);
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    if (!error_) error_ = std::current_exception();
+  }
+  current = outer;
+}
+
+void ppc::core::Team::member(const std::stop_token& stop, std::size_t rank) {
+  std::uint32_t seen = 0;
+  while (true) {
+    generation_.wait(seen, policy_, [&] { return stop.stop_requested(); });
+    if (stop.stop_requested()) return;
+    const std::uint32_t generation = generation_.load();
+    if (generation == seen) continue;
+    seen = generation;
+    invoke_member(invoke_, context_, rank);
+    done_->count_down();
+  }
+}
@@ -0,0 +1,92 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "core/partition/include/partition.hpp"
+
+namespace {
+
+// consecutive ranges from 0 to n
+void check_exact_cover(const std::vector<ppc::core::Range>& ranges, std::size_t n) {
+  std::size_t next = 0;
+  for (const auto& range : ranges) {
+    ASSERT_EQ(range.begin, next);
+    ASSERT_LE(range.begin, range.end);
+    next = range.end;
+  }
+  ASSERT_EQ(next, n);
+}
+
+const std::vector<std::size_t> sizes = {0, 1, 2, 3, 7, 15, 16, 17, 100, 1000, 1023, 1025};
+
+}  // namespace
+
+TEST(partition_tests, check_balanced_keeps_the_remainder) {
+  for (auto n : sizes) {
+    for (std::size_t parts = 1; parts <= 9; parts++) {
+      auto ranges = ppc::core::balanced_partition(n, parts);
+      ASSERT_EQ(ranges.size(), parts);
+      check_exact_cover(ranges, n);
+      for (std::size_t p = 0; p < parts; p++) {
+        // the first n % parts ranges take one element more
+        EXPECT_EQ(ranges[p].size(), n / parts + (p < n % parts ? 1 : 0)) << "n = " << n << ", parts = " << parts;
+        EXPECT_EQ(ppc::core::balanced_range(n, parts, p), ranges[p]);
+      }
+    }
+  }
+}
+
+TEST(partition_tests, check_balanced_aligned_boundaries) {
+  const std::size_t alignment = ppc::core::cache_line_elements<int>();
+  EXPECT_EQ(alignment, 16U);
+  for (auto n : sizes) {
+    for (std::size_t parts = 1; parts <= 9; parts++) {
+      auto ranges = ppc::core::balanced_partition(n, parts, alignment);
+      check_exact_cover(ranges, n);
+      for (const auto& range : ranges) {
+        EXPECT_TRUE(range.begin % alignment == 0 || range.begin == n) << "n = " << n << ", parts = " << parts;
+        // balanced up to one line
+        EXPECT_LE(range.size(), (n / alignment / parts + 2) * alignment);
+      }
+    }
+  }
+}
+
+TEST(partition_tests, check_grain) {
+  for (auto n : sizes) {
+    for (std::size_t grain : {1, 3, 16, 2000}) {
+      auto ranges = ppc::core::grain_partition(n, grain);
+      check_exact_cover(ranges, n);
+      EXPECT_EQ(ranges.size(), (n + grain - 1) / grain);
+      for (std::size_t r = 0; r + 1 < ranges.size(); r++) EXPECT_EQ(ranges[r].size(), grain);
+    }
+  }
+}
+
+TEST(partition_tests, check_guided_shrinks) {
+  for (auto n : sizes) {
+    for (std::size_t parts = 1; parts <= 9; parts++) {
+      auto ranges = ppc::core::guided_partition(n, parts, 4);
+      check_exact_cover(ranges, n);
+      for (std::size_t r = 0; r + 1 < ranges.size(); r++) {
+        EXPECT_GE(ranges[r].size(), ranges[r + 1].size());
+        EXPECT_GE(ranges[r].size(), 4U);
+      }
+      if (n > 0) {
+        EXPECT_EQ(ranges[0].size(), std::min(n, std::max<std::size_t>((n + parts - 1) / parts, 4)));
+      }
+    }
+  }
+}
+
+TEST(partition_tests, check_invalid_arguments) {
+  EXPECT_THROW(ppc::core::balanced_partition(10, 0), std::invalid_argument);
+  EXPECT_THROW(ppc::core::balanced_partition(10, 2, 0), std::invalid_argument);
+  EXPECT_THROW(ppc::core::balanced_range(10, 2, 2), std::out_of_range);
+  EXPECT_THROW(ppc::core::grain_partition(10, 0), std::invalid_argument);
+  EXPECT_THROW(ppc::core::guided_partition(10, 0), std::invalid_argument);
+}
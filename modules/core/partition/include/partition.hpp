@@ -0,0 +1,52 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_PARTITION_HPP_
+#define MODULES_CORE_INCLUDE_PARTITION_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace ppc::core {
+
+// Elements [begin, end) of an input
+struct Range {
+  std::size_t begin;
+  std::size_t end;
+
+  [[nodiscard]] std::size_t size() const { return end - begin; }
+  bool operator==(const Range& other) const = default;
+};
+
+// Every partitioner below returns consecutive ranges that cover [0, n)
+// exactly: the first begins at 0, each begins where the previous one ends and
+// the last ends at n, so no element is lost or counted twice.
+
+// Static balanced split into parts ranges whose sizes differ by at most one,
+// the first n % parts ranges take the extra elements. With alignment > 1 the
+// inner boundaries are multiples of alignment (ranges are balanced in units of
+// alignment elements, some may be empty when n is small).
+std::vector<Range> balanced_partition(std::size_t n, std::size_t parts, std::size_t alignment = 1);
+
+// The range of part number part in balanced_partition(n, parts, alignment),
+// computed without building the others
+Range balanced_range(std::size_t n, std::size_t parts, std::size_t part, std::size_t alignment = 1);
+
+// Ranges of grain elements, the last one shorter when grain does not divide n
+std::vector<Range> grain_partition(std::size_t n, std::size_t grain);
+
+// Guided split for dynamic scheduling: every range takes 1 / parts of the
+// elements not yet assigned, but at least min_grain, so the ranges shrink
+// towards the end and late workers pick up the short ones
+std::vector<Range> guided_partition(std::size_t n, std::size_t parts, std::size_t min_grain = 1);
+
+// Elements of T in a cache line, an alignment that keeps the threads of a
+// balanced_partition off each other's lines when the data is line-aligned
+template <class T>
+constexpr std::size_t cache_line_elements(std::size_t line_bytes = 64) {
+  return std::max<std::size_t>(line_bytes / sizeof(T), 1);
+}
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_PARTITION_HPP_
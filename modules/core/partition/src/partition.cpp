@@ -0,0 +1,54 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/partition/include/partition.hpp"
+
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+void check_positive(std::size_t value, const char* what) {
+  if (value == 0) throw std::invalid_argument(std::string("partition: ") + what + " must be positive");
+}
+
+}  // namespace
+
+ppc::core::Range ppc::core::balanced_range(std::size_t n, std::size_t parts, std::size_t part, std::size_t alignment) {
+  check_positive(parts, "parts");
+  check_positive(alignment, "alignment");
+  if (part >= parts) throw std::out_of_range("partition: part is out of range");
+  // balance whole units of alignment elements, the last unit may be shorter
+  const std::size_t units = (n + alignment - 1) / alignment;
+  const std::size_t base = units / parts;
+  const std::size_t extra = units % parts;
+  auto boundary = [&](std::size_t p) { return std::min(n, (p * base + std::min(p, extra)) * alignment); };
+  return {boundary(part), boundary(part + 1)};
+}
+
+std::vector<ppc::core::Range> ppc::core::balanced_partition(std::size_t n, std::size_t parts, std::size_t alignment) {
+  check_positive(parts, "parts");
+  std::vector<Range> ranges;
+  ranges.reserve(parts);
+  for (std::size_t part = 0; part < parts; part++) ranges.push_back(balanced_range(n, parts, part, alignment));
+  return ranges;
+}
+
+std::vector<ppc::core::Range> ppc::core::grain_partition(std::size_t n, std::size_t grain) {
+  check_positive(grain, "grain");
+  std::vector<Range> ranges;
+  ranges.reserve((n + grain - 1) / grain);
+  for (std::size_t begin = 0; begin < n; begin += grain) ranges.push_back({begin, std::min(n, begin + grain)});
+  return ranges;
+}
+
+std::vector<ppc::core::Range> ppc::core::guided_partition(std::size_t n, std::size_t parts, std::size_t min_grain) {
+  check_positive(parts, "parts");
+  check_positive(min_grain, "min_grain");
+  std::vector<Range> ranges;
+  for (std::size_t begin = 0; begin < n;) {
+    const std::size_t remaining = n - begin;
+    const std::size_t size = std::min(remaining, std::max((remaining + parts - 1) / parts, min_grain));
+    ranges.push_back({begin, begin + size});
+    begin += size;
+  }
+  return ranges;
+}
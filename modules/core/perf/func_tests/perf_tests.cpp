@@ -155,3 +155,134 @@ TEST(perf_tests, check_perf_task_float) {
   ASSERT_LE(perfResults->time_sec, 10.0);
   EXPECT_EQ(out[0], in.size());
 }
+
+TEST(perf_tests, check_perf_fixture_is_not_timed) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create TaskData
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto testTask = std::make_shared<ppc::test::TestTask<uint32_t>>(taskData);
+
+  // Create Perf attributes: every timer call advances the clock by one tick,
+  // every fixture call by a hundred ticks
+  double clock = 0.0;
+  int set_up = 0, tear_down = 0, set_up_iteration = 0, tear_down_iteration = 0;
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  perfAttr->current_timer = [&] { return clock += 1.0; };
+  perfAttr->timer_overhead_sec = 0.0;
+  perfAttr->fixture.set_up = [&] {
+    clock += 100.0;
+    set_up++;
+  };
+  perfAttr->fixture.tear_down = [&] {
+    clock += 100.0;
+    tear_down++;
+  };
+  perfAttr->fixture.set_up_iteration = [&] {
+    clock += 100.0;
+    set_up_iteration++;
+  };
+  perfAttr->fixture.tear_down_iteration = [&] {
+    clock += 100.0;
+    tear_down_iteration++;
+  };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perfAnalyzer(testTask);
+  perfAnalyzer.pipeline_run(perfAttr, perfResults);
+
+  EXPECT_EQ(set_up, 1);
+  EXPECT_EQ(tear_down, 1);
+  EXPECT_EQ(set_up_iteration, 10);
+  EXPECT_EQ(tear_down_iteration, 10);
+  EXPECT_DOUBLE_EQ(perfResults->time_sec, 10.0);
+  EXPECT_EQ(out[0], in.size());
+}
+
+TEST(perf_tests, check_perf_pipeline_per_phase) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create TaskData
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto testTask = std::make_shared<ppc::test::TestTask<uint32_t>>(taskData);
+
+  // Create Perf attributes
+  double clock = 0.0;
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  perfAttr->current_timer = [&] { return clock += 1.0; };
+  perfAttr->timer_overhead_sec = 0.0;
+  perfAttr->timing_mode = ppc::core::PerfAttr::TimingMode::PER_PHASE;
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perfAnalyzer(testTask);
+  perfAnalyzer.pipeline_run(perfAttr, perfResults);
+
+  EXPECT_DOUBLE_EQ(perfResults->validation_time_sec, 10.0);
+  EXPECT_DOUBLE_EQ(perfResults->pre_processing_time_sec, 10.0);
+  EXPECT_DOUBLE_EQ(perfResults->run_time_sec, 10.0);
+  EXPECT_DOUBLE_EQ(perfResults->post_processing_time_sec, 10.0);
+  EXPECT_DOUBLE_EQ(perfResults->time_sec, 40.0);
+  EXPECT_EQ(out[0], in.size());
+}
+
+TEST(perf_tests, check_perf_task_per_phase) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create TaskData
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto testTask = std::make_shared<ppc::test::TestTask<uint32_t>>(taskData);
+
+  // Create Perf attributes
+  double clock = 0.0;
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  perfAttr->current_timer = [&] { return clock += 1.0; };
+  perfAttr->timer_overhead_sec = 0.0;
+  perfAttr->timing_mode = ppc::core::PerfAttr::TimingMode::PER_PHASE;
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perfAnalyzer(testTask);
+  perfAnalyzer.task_run(perfAttr, perfResults);
+
+  EXPECT_DOUBLE_EQ(perfResults->validation_time_sec, 0.0);
+  EXPECT_DOUBLE_EQ(perfResults->pre_processing_time_sec, 0.0);
+  EXPECT_DOUBLE_EQ(perfResults->run_time_sec, 10.0);
+  EXPECT_DOUBLE_EQ(perfResults->post_processing_time_sec, 0.0);
+  EXPECT_DOUBLE_EQ(perfResults->time_sec, 10.0);
+  EXPECT_EQ(out[0], in.size());
+}
@@ -0,0 +1,102 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "core/perf/func_tests/test_task.hpp"
+#include "core/perf/include/perf.hpp"
+#include "core/perf/include/timer.hpp"
+
+using namespace std::chrono_literals;
+
+TEST(timer_tests, check_steady_is_monotonic) {
+  auto begin = ppc::core::timer::steady();
+  std::this_thread::sleep_for(20ms);
+  auto end = ppc::core::timer::steady();
+  EXPECT_GE(end - begin, 0.02);
+  EXPECT_LT(end - begin, 1.0);
+}
+
+TEST(timer_tests, check_tsc_matches_steady) {
+  // the first call calibrates the counter
+  ppc::core::timer::tsc();
+  auto steady_begin = ppc::core::timer::steady();
+  auto tsc_begin = ppc::core::timer::tsc();
+  std::this_thread::sleep_for(50ms);
+  auto tsc_end = ppc::core::timer::tsc();
+  auto steady_end = ppc::core::timer::steady();
+  if (ppc::core::timer::has_invariant_tsc()) {
+    EXPECT_GT(ppc::core::timer::tsc_frequency(), 0.0);
+  } else {
+    EXPECT_EQ(ppc::core::timer::tsc_frequency(), 0.0);
+  }
+  EXPECT_NEAR(tsc_end - tsc_begin, steady_end - steady_begin, 0.1 * (steady_end - steady_begin));
+}
+
+TEST(timer_tests, check_thread_cpu_ignores_sleep) {
+  auto begin = ppc::core::timer::thread_cpu();
+  std::this_thread::sleep_for(50ms);
+  auto end = ppc::core::timer::thread_cpu();
+  EXPECT_LT(end - begin, 0.025);
+
+  begin = ppc::core::timer::thread_cpu();
+  auto wall_begin = ppc::core::timer::steady();
+  while (ppc::core::timer::steady() - wall_begin < 0.02) {
+  }
+  end = ppc::core::timer::thread_cpu();
+  EXPECT_GT(end - begin, 0.0);
+}
+
+TEST(timer_tests, check_process_cpu_counts_every_thread) {
+  auto begin = ppc::core::timer::process_cpu();
+  std::thread busy([] {
+    auto cpu_begin = ppc::core::timer::thread_cpu();
+    while (ppc::core::timer::thread_cpu() - cpu_begin < 0.02) {
+    }
+  });
+  busy.join();
+  auto end = ppc::core::timer::process_cpu();
+  EXPECT_GE(end - begin, 0.019);
+}
+
+TEST(timer_tests, check_overhead_is_measured) {
+  double clock = 0.0;
+  EXPECT_DOUBLE_EQ(ppc::core::timer::measure_overhead([&] { return clock += 1.0; }), 1.0);
+  EXPECT_LT(ppc::core::timer::measure_overhead(ppc::core::timer::steady), 1e-5);
+  EXPECT_LT(ppc::core::timer::measure_overhead(ppc::core::timer::tsc), 1e-5);
+}
+
+TEST(timer_tests, check_default_perf_timer) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create TaskData
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto testTask = std::make_shared<ppc::test::TestTask<uint32_t>>(taskData);
+
+  // Create Perf attributes with the default timer, iterations sleep outside of the measurement
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 5;
+  perfAttr->fixture.set_up_iteration = [] { std::this_thread::sleep_for(10ms); };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perfAnalyzer(testTask);
+  perfAnalyzer.pipeline_run(perfAttr, perfResults);
+
+  EXPECT_GT(perfResults->time_sec, 0.0);
+  EXPECT_LT(perfResults->time_sec, 0.01);
+  EXPECT_GE(perfResults->timer_overhead_sec, 0.0);
+  EXPECT_EQ(out[0], in.size());
+}
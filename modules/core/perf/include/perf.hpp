@@ -6,23 +6,53 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <string>
 #include <vector>
 
+#include "core/perf/include/timer.hpp"
 #include "core/task/include/task.hpp"
 
 namespace ppc {
 namespace core {
 
+// Untimed hooks around a performance measurement. Everything done here
+// (allocating inputs, resetting outputs, flushing caches) is excluded from
+// the reported time.
+struct PerfFixture {
+  // called once before the first and after the last measured iteration
+  std::function<void(void)> set_up = [] {};
+  std::function<void(void)> tear_down = [] {};
+  // called before and after every measured iteration
+  std::function<void(void)> set_up_iteration = [] {};
+  std::function<void(void)> tear_down_iteration = [] {};
+};
+
 struct PerfAttr {
   // count of task's running
   uint64_t num_running;
-  std::function<double(void)> current_timer = [&] { return 0.0; };
+  // time source in seconds, see core/perf/include/timer.hpp for the built-in ones
+  std::function<double(void)> current_timer = ppc::core::timer::steady;
+  // cost of one current_timer() call, subtracted from every measured
+  // interval; a negative value means it is measured before the run
+  double timer_overhead_sec = -1.0;
+  PerfFixture fixture;
+  // WHOLE measures each iteration at once, PER_PHASE additionally splits
+  // the time between validation, pre_processing, run and post_processing
+  enum TimingMode { WHOLE, PER_PHASE } timing_mode = WHOLE;
 };
 
 struct PerfResults {
   // measurement of task's time (in seconds)
   double time_sec = 0.0;
+  // split of time_sec between the pipeline phases, filled in PER_PHASE mode
+  double validation_time_sec = 0.0;
+  double pre_processing_time_sec = 0.0;
+  double run_time_sec = 0.0;
+  double post_processing_time_sec = 0.0;
+  // timer overhead that was subtracted from every measured interval
+  double timer_overhead_sec = 0.0;
   enum TypeOfRunning { PIPELINE, TASK_RUN, NONE } type_of_running = NONE;
+  PerfAttr::TimingMode timing_mode = PerfAttr::TimingMode::WHOLE;
   constexpr const static double MAX_TIME = 10.0;
   constexpr const static double MIN_TIME = 0.05;
 };
@@ -40,13 +70,26 @@ class Perf {
                     const std::shared_ptr<ppc::core::PerfResults>& perfResults);
   // Check performance of task's run() function
   void task_run(const std::shared_ptr<PerfAttr>& perfAttr, const std::shared_ptr<ppc::core::PerfResults>& perfResults);
-  // Pint results for automation checkers
-  static void print_perf_statistic(const std::shared_ptr<PerfResults>& perfResults);
+  // Pint results for automation checkers; a non-empty name is appended to the
+  // task path to tell apart several measurements made in one test file
+  static void print_perf_statistic(const std::shared_ptr<PerfResults>& perfResults, const std::string& name = "");
+  // Print a measurement other than the time, as <task path>/<name>:<metric>:<value>;
+  // the value is not checked against the time limits
+  static void print_perf_metric(const std::string& name, const std::string& metric, double value);
 
  private:
+  enum Phase { VALIDATION, PRE_PROCESSING, RUN, POST_PROCESSING };
+  struct TimedPhase {
+    Phase phase;
+    std::function<void()> body;
+  };
+
   std::shared_ptr<Task> task;
-  static void common_run(const std::shared_ptr<PerfAttr>& perfAttr, const std::function<void()>& pipeline,
+  static void common_run(const std::shared_ptr<PerfAttr>& perfAttr, const std::vector<TimedPhase>& pipeline,
                          const std::shared_ptr<ppc::core::PerfResults>& perfResults);
+  static double& phase_time(Phase phase, PerfResults& perfResults);
+  // path of the running perf test below the repository, with "/name" appended if name is not empty
+  static std::string test_path(const std::string& name);
 };
 
 }  // namespace core
@@ -0,0 +1,37 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_TIMER_HPP_
+#define MODULES_CORE_INCLUDE_TIMER_HPP_
+
+#include <functional>
+
+namespace ppc::core::timer {
+
+// Wall time in seconds from a monotonic clock
+double steady();
+
+// Wall time in seconds from the time stamp counter. The counter frequency is
+// calibrated once against steady(); on CPUs without an invariant TSC (or on
+// non-x86 targets) this falls back to steady().
+double tsc();
+
+// CPU time in seconds consumed by the calling thread
+double thread_cpu();
+
+// CPU time in seconds consumed by all threads of the process
+double process_cpu();
+
+// true if the TSC ticks at a constant rate regardless of frequency scaling
+// and sleep states (CPUID 0x80000007, EDX bit 8)
+bool has_invariant_tsc();
+
+// calibrated TSC ticks per second, 0.0 if tsc() falls back to steady()
+double tsc_frequency();
+
+// Cost in seconds of a single call to the timer, measured as the minimum
+// over several rounds of back-to-back calls
+double measure_overhead(const std::function<double(void)>& current_timer);
+
+}  // namespace ppc::core::timer
+
+#endif  // MODULES_CORE_INCLUDE_TIMER_HPP_
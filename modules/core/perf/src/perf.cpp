@@ -3,6 +3,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -19,47 +20,101 @@ void ppc::core::Perf::pipeline_run(const std::shared_ptr<PerfAttr>& perfAttr,
                                    const std::shared_ptr<ppc::core::PerfResults>& perfResults) {
   perfResults->type_of_running = PerfResults::TypeOfRunning::PIPELINE;
 
-  common_run(
-      std::move(perfAttr),
-      [&]() {
-        task->validation();
-        task->pre_processing();
-        task->run();
-        task->post_processing();
-      },
-      std::move(perfResults));
+  perfAttr->fixture.set_up();
+  common_run(perfAttr,
+             {{Phase::VALIDATION, [&]() { task->validation(); }},
+              {Phase::PRE_PROCESSING, [&]() { task->pre_processing(); }},
+              {Phase::RUN, [&]() { task->run(); }},
+              {Phase::POST_PROCESSING, [&]() { task->post_processing(); }}},
+             perfResults);
+  perfAttr->fixture.tear_down();
 }
 
 void ppc::core::Perf::task_run(const std::shared_ptr<PerfAttr>& perfAttr,
                                const std::shared_ptr<ppc::core::PerfResults>& perfResults) {
   perfResults->type_of_running = PerfResults::TypeOfRunning::TASK_RUN;
 
+  perfAttr->fixture.set_up();
   task->validation();
   task->pre_processing();
-  common_run(
-      std::move(perfAttr), [&]() { task->run(); }, std::move(perfResults));
+  common_run(perfAttr, {{Phase::RUN, [&]() { task->run(); }}}, perfResults);
   task->post_processing();
 
+  // Untimed: repeated run() calls may accumulate into the outputs, so one
+  // more full pipeline leaves them holding the result of a single run
   task->validation();
   task->pre_processing();
   task->run();
   task->post_processing();
+  perfAttr->fixture.tear_down();
 }
 
-void ppc::core::Perf::common_run(const std::shared_ptr<PerfAttr>& perfAttr, const std::function<void()>& pipeline,
+void ppc::core::Perf::common_run(const std::shared_ptr<PerfAttr>& perfAttr, const std::vector<TimedPhase>& pipeline,
                                  const std::shared_ptr<ppc::core::PerfResults>& perfResults) {
-  auto begin = perfAttr->current_timer();
+  perfResults->timing_mode = perfAttr->timing_mode;
+  perfResults->time_sec = 0.0;
+  perfResults->validation_time_sec = 0.0;
+  perfResults->pre_processing_time_sec = 0.0;
+  perfResults->run_time_sec = 0.0;
+  perfResults->post_processing_time_sec = 0.0;
+  perfResults->timer_overhead_sec = perfAttr->timer_overhead_sec < 0.0
+                                        ? ppc::core::timer::measure_overhead(perfAttr->current_timer)
+                                        : perfAttr->timer_overhead_sec;
+  auto interval = [&](double begin, double end) {
+    return std::max(end - begin - perfResults->timer_overhead_sec, 0.0);
+  };
+
   for (uint64_t i = 0; i < perfAttr->num_running; i++) {
-    pipeline();
+    perfAttr->fixture.set_up_iteration();
+    auto begin = perfAttr->current_timer();
+    if (perfAttr->timing_mode == PerfAttr::TimingMode::PER_PHASE) {
+      for (const auto& timed_phase : pipeline) {
+        timed_phase.body();
+        auto end = perfAttr->current_timer();
+        phase_time(timed_phase.phase, *perfResults) += interval(begin, end);
+        perfResults->time_sec += interval(begin, end);
+        begin = end;
+      }
+    } else {
+      for (const auto& timed_phase : pipeline) {
+        timed_phase.body();
+      }
+      auto end = perfAttr->current_timer();
+      perfResults->time_sec += interval(begin, end);
+    }
+    perfAttr->fixture.tear_down_iteration();
+  }
+}
+
+double& ppc::core::Perf::phase_time(Phase phase, PerfResults& perfResults) {
+  switch (phase) {
+    case Phase::VALIDATION:
+      return perfResults.validation_time_sec;
+    case Phase::PRE_PROCESSING:
+      return perfResults.pre_processing_time_sec;
+    case Phase::POST_PROCESSING:
+      return perfResults.post_processing_time_sec;
+    default:
+      return perfResults.run_time_sec;
   }
-  auto end = perfAttr->current_timer();
-  perfResults->time_sec = end - begin;
 }
 
-void ppc::core::Perf::print_perf_statistic(const std::shared_ptr<PerfResults>& perfResults) {
+std::string ppc::core::Perf::test_path(const std::string& name) {
   std::string relative_path(::testing::UnitTest::GetInstance()->current_test_info()->file());
   std::string ppc_regex_template("parallel_programming_course");
   std::string perf_regex_template("perf_tests");
+
+  auto first_found_position = relative_path.find(ppc_regex_template) + ppc_regex_template.length() + 1;
+  relative_path.erase(0, first_found_position);
+
+  auto last_found_position = relative_path.find(perf_regex_template) - 1;
+  relative_path.erase(last_found_position, relative_path.length() - 1);
+  if (!name.empty()) relative_path += "/" + name;
+  return relative_path;
+}
+
+void ppc::core::Perf::print_perf_statistic(const std::shared_ptr<PerfResults>& perfResults, const std::string& name) {
+  std::string relative_path = test_path(name);
   std::string type_test_name;
 
   auto time_secs = perfResults->time_sec;
@@ -72,12 +127,6 @@ void ppc::core::Perf::print_perf_statistic(const std::shared_ptr<PerfResults>& p
     type_test_name = "none";
   }
 
-  auto first_found_position = relative_path.find(ppc_regex_template) + ppc_regex_template.length() + 1;
-  relative_path.erase(0, first_found_position);
-
-  auto last_found_position = relative_path.find(perf_regex_template) - 1;
-  relative_path.erase(last_found_position, relative_path.length() - 1);
-
   std::stringstream perf_res_str;
   if (time_secs > PerfResults::MIN_TIME && time_secs < PerfResults::MAX_TIME) {
     perf_res_str << std::fixed << std::setprecision(10) << time_secs;
@@ -90,4 +139,16 @@ void ppc::core::Perf::print_perf_statistic(const std::shared_ptr<PerfResults>& p
   }
 
   std::cout << relative_path << ":" << type_test_name << ":" << perf_res_str.str() << std::endl;
+
+  if (perfResults->timing_mode == PerfAttr::TimingMode::PER_PHASE) {
+    std::cout << relative_path << ":" << type_test_name << ":" << std::fixed << std::setprecision(10)
+              << "validation=" << perfResults->validation_time_sec
+              << " pre_processing=" << perfResults->pre_processing_time_sec
+              << " run=" << perfResults->run_time_sec
+              << " post_processing=" << perfResults->post_processing_time_sec << std::endl;
+  }
+}
+
+void ppc::core::Perf::print_perf_metric(const std::string& name, const std::string& metric, double value) {
+  std::cout << test_path(name) << ":" << metric << ":" << std::fixed << std::setprecision(10) << value << std::endl;
 }
@@ -0,0 +1,151 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/perf/include/timer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <limits>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define PPC_TIMER_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+#endif
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+namespace {
+
+#ifdef PPC_TIMER_X86
+inline uint64_t read_tsc() {
+  // lfence keeps rdtsc from being executed ahead of the preceding loads
+  _mm_lfence();
+  return __rdtsc();
+}
+
+bool detect_invariant_tsc() {
+  unsigned int regs[4] = {0, 0, 0, 0};
+#if defined(_MSC_VER)
+  int info[4];
+  __cpuid(info, 0x80000000);
+  if (static_cast<unsigned int>(info[0]) < 0x80000007U) return false;
+  __cpuid(info, 0x80000007);
+  regs[3] = static_cast<unsigned int>(info[3]);
+#else
+  if (__get_cpuid_max(0x80000000U, nullptr) < 0x80000007U) return false;
+  __get_cpuid(0x80000007U, &regs[0], &regs[1], &regs[2], &regs[3]);
+#endif
+  return (regs[3] & (1U << 8)) != 0;
+}
+#endif
+
+struct TscCalibration {
+  bool invariant = false;
+  uint64_t base_ticks = 0;
+  double seconds_per_tick = 0.0;
+
+  TscCalibration() {
+#ifdef PPC_TIMER_X86
+    invariant = detect_invariant_tsc();
+    if (!invariant) return;
+    // spin for ~20 ms of steady time and fit the tick rate over that window
+    const auto steady_begin = std::chrono::steady_clock::now();
+    const auto ticks_begin = read_tsc();
+    auto steady_end = steady_begin;
+    while (steady_end - steady_begin < std::chrono::milliseconds(20)) {
+      steady_end = std::chrono::steady_clock::now();
+    }
+    const auto ticks_end = read_tsc();
+    const auto elapsed = std::chrono::duration<double>(steady_end - steady_begin).count();
+    seconds_per_tick = elapsed / static_cast<double>(ticks_end - ticks_begin);
+    base_ticks = ticks_begin;
+#endif
+  }
+};
+
+const TscCalibration& tsc_calibration() {
+  static const TscCalibration calibration;
+  return calibration;
+}
+
+}  // namespace
+
+double ppc::core::timer::steady() {
+  static const auto t0 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+double ppc::core::timer::tsc() {
+#ifdef PPC_TIMER_X86
+  const auto& calibration = tsc_calibration();
+  if (calibration.invariant) {
+    return static_cast<double>(read_tsc() - calibration.base_ticks) * calibration.seconds_per_tick;
+  }
+#endif
+  return steady();
+}
+
+double ppc::core::timer::thread_cpu() {
+#if defined(_WIN32)
+  FILETIME creation, exit, kernel, user;
+  GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user);
+  auto to_ticks = [](const FILETIME& t) {
+    return (static_cast<uint64_t>(t.dwHighDateTime) << 32) | static_cast<uint64_t>(t.dwLowDateTime);
+  };
+  // FILETIME counts 100 ns intervals
+  return static_cast<double>(to_ticks(kernel) + to_ticks(user)) * 1e-7;
+#elif defined(CLOCK_THREAD_CPUTIME_ID)
+  timespec ts{};
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec) * 1e-9;
+#else
+  return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+#endif
+}
+
+double ppc::core::timer::process_cpu() {
+#if defined(_WIN32)
+  FILETIME creation, exit, kernel, user;
+  GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user);
+  auto to_ticks = [](const FILETIME& t) {
+    return (static_cast<uint64_t>(t.dwHighDateTime) << 32) | static_cast<uint64_t>(t.dwLowDateTime);
+  };
+  return static_cast<double>(to_ticks(kernel) + to_ticks(user)) * 1e-7;
+#elif defined(CLOCK_PROCESS_CPUTIME_ID)
+  timespec ts{};
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec) * 1e-9;
+#else
+  return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+#endif
+}
+
+bool ppc::core::timer::has_invariant_tsc() { return tsc_calibration().invariant; }
+
+double ppc::core::timer::tsc_frequency() {
+  const auto& calibration = tsc_calibration();
+  return calibration.invariant ? 1.0 / calibration.seconds_per_tick : 0.0;
+}
+
+double ppc::core::timer::measure_overhead(const std::function<double(void)>& current_timer) {
+  const int rounds = 16;
+  const int calls_per_round = 64;
+  auto overhead = std::numeric_limits<double>::max();
+  for (int round = 0; round < rounds; round++) {
+    auto begin = current_timer();
+    for (int i = 0; i < calls_per_round - 1; i++) {
+      current_timer();
+    }
+    auto end = current_timer();
+    overhead = std::min(overhead, (end - begin) / calls_per_round);
+  }
+  return std::max(overhead, 0.0);
+}
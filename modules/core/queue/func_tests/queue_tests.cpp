@@ -0,0 +1,169 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core/queue/include/bounded_queue.hpp"
+#include "core/queue/include/segmented_queue.hpp"
+
+namespace {
+
+// Counts the live instances to catch leaked or doubly destroyed elements
+struct Counted {
+  static std::atomic<int> alive;
+
+  explicit Counted(int v) : value(v) { alive++; }
+  Counted(const Counted& other) : value(other.value) { alive++; }
+  Counted(Counted&& other) noexcept : value(other.value) { alive++; }
+  Counted& operator=(const Counted&) = default;
+  Counted& operator=(Counted&&) noexcept = default;
+  ~Counted() { alive--; }
+
+  int value;
+};
+
+std::atomic<int> Counted::alive{0};
+
+// Producers push producer * per_producer + i for i in [0, per_producer),
+// consumers pop until everything arrived. Every value must arrive once and
+// every consumer must see the values of one producer in increasing order.
+template <class Push, class Pop>
+void check_mpmc(std::size_t producers, std::size_t consumers, const Push& push, const Pop& pop) {
+  const std::uint64_t per_producer = 20000;
+  const std::uint64_t total = producers * per_producer;
+  std::vector<std::atomic<int>> seen(total);
+  std::atomic<std::uint64_t> popped{0};
+  std::atomic<bool> ordered{true};
+
+  std::vector<std::thread> threads;
+  for (std::size_t p = 0; p < producers; p++) {
+    threads.emplace_back([&, p] {
+      for (std::uint64_t i = 0; i < per_producer; i++) push(p * per_producer + i);
+    });
+  }
+  for (std::size_t c = 0; c < consumers; c++) {
+    threads.emplace_back([&] {
+      std::vector<std::int64_t> last(producers, -1);
+      while (popped.load() < total) {
+        const std::optional<std::uint64_t> value = pop();
+        if (!value) {
+          std::this_thread::yield();
+          continue;
+        }
+        seen[*value]++;
+        popped++;
+        auto& previous = last[*value / per_producer];
+        if (static_cast<std::int64_t>(*value) <= previous) ordered = false;
+        previous = static_cast<std::int64_t>(*value);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  EXPECT_TRUE(ordered.load());
+  for (std::uint64_t v = 0; v < total; v++) ASSERT_EQ(seen[v].load(), 1) << "value " << v;
+}
+
+}  // namespace
+
+TEST(queue_tests, check_bounded_fifo_and_capacity) {
+  ppc::core::BoundedQueue<int> queue(5);
+  EXPECT_EQ(queue.capacity(), 8U);
+  EXPECT_EQ(ppc::core::BoundedQueue<int>(1).capacity(), 2U);
+  EXPECT_FALSE(queue.try_pop().has_value());
+  for (int round = 0; round < 3; round++) {
+    for (int i = 0; i < 8; i++) EXPECT_TRUE(queue.try_push(i));
+    EXPECT_FALSE(queue.try_push(8));
+    for (int i = 0; i < 8; i++) EXPECT_EQ(queue.try_pop(), i);
+    EXPECT_FALSE(queue.try_pop().has_value());
+  }
+}
+
+TEST(queue_tests, check_bounded_keeps_the_value_when_full) {
+  ppc::core::BoundedQueue<std::unique_ptr<int>> queue(2);
+  EXPECT_TRUE(queue.try_push(std::make_unique<int>(1)));
+  EXPECT_TRUE(queue.try_push(std::make_unique<int>(2)));
+  auto value = std::make_unique<int>(3);
+  EXPECT_FALSE(queue.try_push(std::move(value)));
+  ASSERT_NE(value, nullptr);
+  EXPECT_EQ(*value, 3);
+  EXPECT_EQ(**queue.try_pop(), 1);
+  EXPECT_TRUE(queue.try_push(std::move(value)));
+  EXPECT_EQ(**queue.try_pop(), 2);
+  EXPECT_EQ(**queue.try_pop(), 3);
+}
+
+TEST(queue_tests, check_bounded_destroys_elements) {
+  {
+    ppc::core::BoundedQueue<Counted> queue(16);
+    for (int i = 0; i < 10; i++) queue.try_push(Counted(i));
+    EXPECT_EQ(queue.try_pop()->value, 0);
+    EXPECT_EQ(Counted::alive.load(), 9);
+  }
+  EXPECT_EQ(Counted::alive.load(), 0);
+}
+
+TEST(queue_tests, check_bounded_mpmc) {
+  for (std::size_t threads : {1, 2, 4}) {
+    ppc::core::BoundedQueue<std::uint64_t> queue(64);
+    check_mpmc(
+        threads, threads,
+        [&](std::uint64_t v) {
+          while (!queue.try_push(v)) std::this_thread::yield();
+        },
+        [&] { return queue.try_pop(); });
+  }
+  ppc::core::BoundedQueue<std::uint64_t> queue(16);
+  check_mpmc(
+      3, 1,
+      [&](std::uint64_t v) {
+        while (!queue.try_push(v)) std::this_thread::yield();
+      },
+      [&] { return queue.try_pop(); });
+}
+
+TEST(queue_tests, check_segmented_fifo_across_segments) {
+  ppc::core::SegmentedQueue<std::string> queue(4);
+  EXPECT_EQ(queue.segment_size(), 4U);
+  EXPECT_FALSE(queue.try_pop().has_value());
+  for (int round = 0; round < 3; round++) {
+    for (int i = 0; i < 37; i++) queue.push(std::to_string(i));
+    for (int i = 0; i < 37; i++) EXPECT_EQ(queue.try_pop(), std::to_string(i));
+    EXPECT_FALSE(queue.try_pop().has_value());
+  }
+}
+
+TEST(queue_tests, check_segmented_destroys_elements) {
+  {
+    ppc::core::SegmentedQueue<Counted> queue(3);
+    for (int i = 0; i < 10; i++) queue.push(Counted(i));
+    for (int i = 0; i < 4; i++) EXPECT_EQ(queue.try_pop()->value, i);
+    EXPECT_EQ(Counted::alive.load(), 6);
+  }
+  EXPECT_EQ(Counted::alive.load(), 0);
+}
+
+TEST(queue_tests, check_segmented_mpmc) {
+  // small segments, so that segments are linked and retired all the time
+  for (std::size_t threads : {1, 2, 4}) {
+    ppc::core::SegmentedQueue<std::uint64_t> queue(8);
+    check_mpmc(
+        threads, threads, [&](std::uint64_t v) { queue.push(v); }, [&] { return queue.try_pop(); });
+  }
+  ppc::core::SegmentedQueue<std::uint64_t> queue(8);
+  check_mpmc(
+      1, 3, [&](std::uint64_t v) { queue.push(v); }, [&] { return queue.try_pop(); });
+}
+
+TEST(queue_tests, check_invalid_arguments) {
+  EXPECT_THROW(ppc::core::BoundedQueue<int>(0), std::invalid_argument);
+  EXPECT_THROW(ppc::core::SegmentedQueue<int>(0), std::invalid_argument);
+}
@@ -0,0 +1,122 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_BOUNDED_QUEUE_HPP_
+#define MODULES_CORE_INCLUDE_BOUNDED_QUEUE_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ppc::core {
+
+// Bounded lock-free multi-producer multi-consumer FIFO queue after Dmitry
+// Vyukov's ring buffer. Every cell carries a sequence number that tells
+// whose turn it is: pos when a producer may fill it, pos + 1 when the
+// consumer of pos may empty it. A push or a pop claims its position with one
+// CAS and hands the cell over with one store, so threads only contend on the
+// two position counters and on the cells they actually touch.
+template <class T>
+class BoundedQueue {
+  // a push whose move throws after the claim would leave its cell unusable
+  static_assert(std::is_nothrow_move_constructible_v<T>, "queue elements must be nothrow move constructible");
+
+ public:
+  // room for capacity elements, rounded up to a power of two of at least 2
+  explicit BoundedQueue(std::size_t capacity) {
+    if (capacity == 0) throw std::invalid_argument("queue capacity must be positive");
+    capacity = std::bit_ceil(std::max<std::size_t>(capacity, 2));
+    cells_ = std::make_unique<Cell[]>(capacity);
+    mask_ = capacity - 1;
+    for (std::size_t i = 0; i < capacity; i++) cells_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
+  ~BoundedQueue() {
+    while (try_pop()) {
+    }
+  }
+
+  BoundedQueue(const BoundedQueue&) = delete;
+  BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+  [[nodiscard]] std::size_t capacity() const { return mask_ + 1; }
+
+  // Appends value unless the queue is full; a value that was not pushed is
+  // left untouched
+  bool try_push(T&& value) {
+    Cell* cell = nullptr;
+    std::size_t pos = enqueue_pos_.value.load(std::memory_order_relaxed);
+    while (true) {
+      cell = &cells_[pos & mask_];
+      const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+      if (diff == 0) {
+        if (enqueue_pos_.value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+      } else if (diff < 0) {
+        // the cell still holds the element pushed one lap ago
+        return false;
+      } else {
+        pos = enqueue_pos_.value.load(std::memory_order_relaxed);
+      }
+    }
+    new (cell->storage) T(std::move(value));
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool try_push(const T& value) {
+    T copy(value);
+    return try_push(std::move(copy));
+  }
+
+  // Removes the oldest element, nothing if the queue is empty or the push
+  // of the oldest element has claimed its cell but not filled it yet
+  std::optional<T> try_pop() {
+    Cell* cell = nullptr;
+    std::size_t pos = dequeue_pos_.value.load(std::memory_order_relaxed);
+    while (true) {
+      cell = &cells_[pos & mask_];
+      const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(sequence - (pos + 1));
+      if (diff == 0) {
+        if (dequeue_pos_.value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+      } else if (diff < 0) {
+        return std::nullopt;
+      } else {
+        pos = dequeue_pos_.value.load(std::memory_order_relaxed);
+      }
+    }
+    T* element = std::launder(reinterpret_cast<T*>(cell->storage));
+    std::optional<T> result(std::move(*element));
+    element->~T();
+    // the cell is free for the push one lap later
+    cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+    return result;
+  }
+
+ private:
+  struct Cell {
+    std::atomic<std::size_t> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  // the positions are hammered by different sides, so each gets a line
+  struct alignas(64) Position {
+    std::atomic<std::size_t> value{0};
+  };
+
+  std::unique_ptr<Cell[]> cells_;
+  std::size_t mask_ = 0;
+  Position enqueue_pos_;
+  Position dequeue_pos_;
+};
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_BOUNDED_QUEUE_HPP_
@@ -0,0 +1,189 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_SEGMENTED_QUEUE_HPP_
+#define MODULES_CORE_INCLUDE_SEGMENTED_QUEUE_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ppc::core {
+
+// Unbounded lock-free multi-producer multi-consumer FIFO queue: a linked list
+// of segments of segment_size cells. Unlike the cells of BoundedQueue, every
+// cell is used once: a push claims the next cell of the tail segment with a
+// fetch_add and, when the segment is used up, links a new one; a pop claims
+// the next filled cell of the head segment with a CAS and moves the head on
+// once the segment is drained.
+//
+// A drained segment may still be read by operations that loaded it before
+// the head moved on, so it is retired, not freed, and the retired segments
+// are freed by the last operation to leave the queue while no other
+// operation is inside it.
+template <class T>
+class SegmentedQueue {
+  // a push whose move throws after the claim would leave its cell unusable
+  static_assert(std::is_nothrow_move_constructible_v<T>, "queue elements must be nothrow move constructible");
+
+ public:
+  explicit SegmentedQueue(std::size_t segment_size = 1024) : segment_size_(segment_size) {
+    if (segment_size == 0) throw std::invalid_argument("queue segment size must be positive");
+    auto* segment = new Segment(segment_size);
+    head_.store(segment);
+    tail_.store(segment);
+  }
+
+  ~SegmentedQueue() {
+    for (auto* segment = head_.load(); segment != nullptr;) delete std::exchange(segment, segment->next.load());
+    free_chain(retired_.load());
+  }
+
+  SegmentedQueue(const SegmentedQueue&) = delete;
+  SegmentedQueue& operator=(const SegmentedQueue&) = delete;
+
+  [[nodiscard]] std::size_t segment_size() const { return segment_size_; }
+
+  void push(T&& value) {
+    Operation operation(*this);
+    Segment* segment = tail_.load();
+    while (true) {
+      const std::size_t pos = segment->enqueue_pos.fetch_add(1, std::memory_order_relaxed);
+      if (pos < segment_size_) {
+        Cell& cell = segment->cells[pos];
+        new (cell.storage) T(std::move(value));
+        cell.ready.store(true, std::memory_order_release);
+        return;
+      }
+      // used up: link a new segment unless another push did, and move the
+      // tail on for everybody
+      Segment* next = segment->next.load();
+      if (next == nullptr) {
+        auto fresh = std::make_unique<Segment>(segment_size_);
+        if (segment->next.compare_exchange_strong(next, fresh.get())) next = fresh.release();
+      }
+      tail_.compare_exchange_strong(segment, next);
+      segment = tail_.load();
+    }
+  }
+
+  void push(const T& value) {
+    T copy(value);
+    push(std::move(copy));
+  }
+
+  // Removes the oldest element, nothing if the queue is empty or the push
+  // of the oldest element has claimed its cell but not filled it yet
+  std::optional<T> try_pop() {
+    Operation operation(*this);
+    Segment* segment = head_.load();
+    while (true) {
+      std::size_t pos = segment->dequeue_pos.load(std::memory_order_relaxed);
+      if (pos < segment_size_) {
+        Cell& cell = segment->cells[pos];
+        if (!cell.ready.load(std::memory_order_acquire)) return std::nullopt;
+        if (!segment->dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) continue;
+        T* element = std::launder(reinterpret_cast<T*>(cell.storage));
+        std::optional<T> result(std::move(*element));
+        element->~T();
+        return result;
+      }
+      Segment* next = segment->next.load();
+      if (next == nullptr) return std::nullopt;
+      Segment* expected = segment;
+      if (head_.compare_exchange_strong(expected, next)) {
+        // the tail must not lag behind on the segment that goes away
+        expected = segment;
+        tail_.compare_exchange_strong(expected, next);
+        retire(segment);
+        segment = next;
+      } else {
+        segment = expected;
+      }
+    }
+  }
+
+ private:
+  struct Cell {
+    std::atomic<bool> ready{false};
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  struct Segment {
+    explicit Segment(std::size_t cells_count) : size(cells_count), cells(std::make_unique<Cell[]>(cells_count)) {}
+
+    ~Segment() {
+      // only a queue being destroyed still has elements in its segments
+      const std::size_t end = std::min(enqueue_pos.load(), size);
+      for (std::size_t pos = dequeue_pos.load(); pos < end; pos++) {
+        if (cells[pos].ready.load()) std::launder(reinterpret_cast<T*>(cells[pos].storage))->~T();
+      }
+    }
+
+    std::size_t size;
+    std::unique_ptr<Cell[]> cells;
+    alignas(64) std::atomic<std::size_t> enqueue_pos{0};
+    alignas(64) std::atomic<std::size_t> dequeue_pos{0};
+    std::atomic<Segment*> next{nullptr};
+    Segment* next_retired = nullptr;
+  };
+
+  // Counts the operations inside the queue for the reclamation of the
+  // drained segments
+  class Operation {
+   public:
+    explicit Operation(SegmentedQueue& queue) : queue_(queue) { queue_.active_.fetch_add(1); }
+    ~Operation() {
+      if (queue_.active_.fetch_sub(1) == 1 && queue_.retired_.load() != nullptr) queue_.reclaim();
+    }
+
+    Operation(const Operation&) = delete;
+    Operation& operator=(const Operation&) = delete;
+
+   private:
+    SegmentedQueue& queue_;
+  };
+
+  void retire(Segment* segment) { push_chain(segment, segment); }
+
+  void push_chain(Segment* first, Segment* last) {
+    Segment* top = retired_.load();
+    do {
+      last->next_retired = top;
+    } while (!retired_.compare_exchange_weak(top, first));
+  }
+
+  // An operation that still reads a retired segment loaded it before the
+  // segment was retired, so it was counted in active_ before the chain was
+  // taken and is still counted when active_ is read after that
+  void reclaim() {
+    Segment* chain = retired_.exchange(nullptr);
+    if (chain == nullptr) return;
+    if (active_.load() == 0) {
+      free_chain(chain);
+      return;
+    }
+    Segment* last = chain;
+    while (last->next_retired != nullptr) last = last->next_retired;
+    push_chain(chain, last);
+  }
+
+  static void free_chain(Segment* chain) {
+    while (chain != nullptr) delete std::exchange(chain, chain->next_retired);
+  }
+
+  std::size_t segment_size_;
+  alignas(64) std::atomic<Segment*> head_{nullptr};
+  alignas(64) std::atomic<Segment*> tail_{nullptr};
+  alignas(64) std::atomic<std::size_t> active_{0};
+  std::atomic<Segment*> retired_{nullptr};
+};
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_SEGMENTED_QUEUE_HPP_
@@ -0,0 +1,216 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/perf/include/timer.hpp"
+#include "core/queue/include/bounded_queue.hpp"
+#include "core/queue/include/segmented_queue.hpp"
+#include "core/task/include/task.hpp"
+
+namespace {
+
+// elements moved through the queue by one run()
+constexpr std::uint64_t kItems = 1 << 16;
+// every kSampleEvery-th element carries its enqueue time for the latency
+constexpr std::uint64_t kSampleEvery = 64;
+constexpr double kMeasureSeconds = 0.15;
+
+// The baseline: one lock around a std::queue
+class LockedQueue {
+ public:
+  void push(std::uint64_t value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.push(value);
+  }
+
+  std::optional<std::uint64_t> try_pop() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) return std::nullopt;
+    auto value = queue_.front();
+    queue_.pop();
+    return value;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::queue<std::uint64_t> queue_;
+};
+
+void push(ppc::core::BoundedQueue<std::uint64_t>& queue, std::uint64_t value) {
+  while (!queue.try_push(value)) std::this_thread::yield();
+}
+
+void push(ppc::core::SegmentedQueue<std::uint64_t>& queue, std::uint64_t value) { queue.push(value); }
+
+void push(LockedQueue& queue, std::uint64_t value) { queue.push(value); }
+
+std::uint64_t now_ns() {
+  return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+// Moves kItems elements from producers threads to consumers threads through
+// a fresh queue. A sampled element holds the time it was pushed, the
+// others 0, and the consumers keep how long the sampled ones were queued.
+template <class Queue>
+class QueueBenchmark : public ppc::core::Task {
+ public:
+  QueueBenchmark(std::shared_ptr<ppc::core::TaskData> taskData_, std::size_t producers, std::size_t consumers,
+                 std::function<std::unique_ptr<Queue>()> make_queue)
+      : Task(std::move(taskData_)), producers_(producers), consumers_(consumers), make_queue_(std::move(make_queue)) {}
+
+  bool validation() override {
+    internal_order_test();
+    return producers_ > 0 && consumers_ > 0;
+  }
+
+  bool pre_processing() override {
+    internal_order_test();
+    queue_ = make_queue_();
+    popped_ = 0;
+    return true;
+  }
+
+  bool run() override {
+    internal_order_test();
+    std::atomic<bool> start{false};
+    std::atomic<std::size_t> producers_done{0};
+    std::atomic<std::uint64_t> popped{0};
+    std::vector<std::vector<std::uint64_t>> latencies(consumers_);
+
+    std::vector<std::thread> threads;
+    for (std::size_t p = 0; p < producers_; p++) {
+      threads.emplace_back([&, p] {
+        while (!start.load(std::memory_order_acquire)) std::this_thread::yield();
+        const std::uint64_t begin = kItems * p / producers_;
+        const std::uint64_t end = kItems * (p + 1) / producers_;
+        for (std::uint64_t i = begin; i < end; i++) push(*queue_, i % kSampleEvery == 0 ? now_ns() : 0);
+        producers_done.fetch_add(1, std::memory_order_release);
+      });
+    }
+    for (std::size_t c = 0; c < consumers_; c++) {
+      threads.emplace_back([&, c] {
+        while (!start.load(std::memory_order_acquire)) std::this_thread::yield();
+        std::uint64_t count = 0;
+        while (true) {
+          if (auto value = queue_->try_pop()) {
+            count++;
+            if (*value != 0) latencies[c].push_back(now_ns() - *value);
+          } else if (producers_done.load(std::memory_order_acquire) == producers_) {
+            // every push is complete, so empty means drained
+            if (!queue_->try_pop().has_value()) break;
+            count++;
+          } else {
+            std::this_thread::yield();
+          }
+        }
+        popped.fetch_add(count);
+      });
+    }
+    start.store(true, std::memory_order_release);
+    for (auto& thread : threads) thread.join();
+
+    popped_ += popped.load();
+    for (const auto& l : latencies) latencies_.insert(latencies_.end(), l.begin(), l.end());
+    return true;
+  }
+
+  bool post_processing() override {
+    internal_order_test();
+    return popped_ == kItems;
+  }
+
+  std::vector<std::uint64_t>& latencies() { return latencies_; }
+
+ private:
+  std::size_t producers_;
+  std::size_t consumers_;
+  std::function<std::unique_ptr<Queue>()> make_queue_;
+  std::unique_ptr<Queue> queue_;
+  std::uint64_t popped_ = 0;
+  std::vector<std::uint64_t> latencies_;
+};
+
+double percentile(std::vector<std::uint64_t>& values, double fraction) {
+  if (values.empty()) return 0.0;
+  const auto index = static_cast<std::size_t>(fraction * static_cast<double>(values.size() - 1));
+  std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(index), values.end());
+  return static_cast<double>(values[index]);
+}
+
+// 1 to hardware_concurrency() threads on each side, then all producers
+// against one consumer and the other way round
+std::vector<std::pair<std::size_t, std::size_t>> thread_cases() {
+  const std::size_t n = std::max(std::thread::hardware_concurrency(), 2U);
+  std::vector<std::pair<std::size_t, std::size_t>> cases;
+  for (std::size_t k = 1; k < n; k *= 2) cases.emplace_back(k, k);
+  cases.emplace_back(n, n);
+  cases.emplace_back(n, 1);
+  cases.emplace_back(1, n);
+  return cases;
+}
+
+// Prints for every thread case the time of the run()s, the throughput in
+// million elements per second and the median and 99th percentile of the
+// time a sampled element spent in the queue
+template <class Queue>
+void run_queue_perf(const std::string& name, const std::function<std::unique_ptr<Queue>()>& make_queue) {
+  for (auto [producers, consumers] : thread_cases()) {
+    auto task = std::make_shared<QueueBenchmark<Queue>>(std::make_shared<ppc::core::TaskData>(), producers, consumers,
+                                                        make_queue);
+    ppc::core::Perf perfAnalyzer(task);
+    auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+    auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+    const double begin = ppc::core::timer::steady();
+    ASSERT_TRUE(task->validation());
+    task->pre_processing();
+    task->run();
+    ASSERT_TRUE(task->post_processing());
+    const double once = ppc::core::timer::steady() - begin;
+    perfAttr->num_running = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(kMeasureSeconds / once)));
+    task->latencies().clear();
+
+    perfAnalyzer.task_run(perfAttr, perfResults);
+    const std::string case_name = name + "/p" + std::to_string(producers) + "_c" + std::to_string(consumers);
+    ppc::core::Perf::print_perf_statistic(perfResults, case_name);
+
+    const auto items = static_cast<double>(kItems * perfAttr->num_running);
+    ppc::core::Perf::print_perf_metric(case_name, "throughput_mops", items / perfResults->time_sec / 1e6);
+    ppc::core::Perf::print_perf_metric(case_name, "latency_p50_ns", percentile(task->latencies(), 0.5));
+    ppc::core::Perf::print_perf_metric(case_name, "latency_p99_ns", percentile(task->latencies(), 0.99));
+  }
+}
+
+}  // namespace
+
+TEST(queue_perf_tests, test_bounded_queue) {
+  run_queue_perf<ppc::core::BoundedQueue<std::uint64_t>>(
+      "bounded", [] { return std::make_unique<ppc::core::BoundedQueue<std::uint64_t>>(1024); });
+}
+
+TEST(queue_perf_tests, test_segmented_queue) {
+  run_queue_perf<ppc::core::SegmentedQueue<std::uint64_t>>(
+      "segmented", [] { return std::make_unique<ppc::core::SegmentedQueue<std::uint64_t>>(1024); });
+}
+
+TEST(queue_perf_tests, test_mutex_queue) {
+  run_queue_perf<LockedQueue>("mutex", [] { return std::make_unique<LockedQueue>(); });
+}
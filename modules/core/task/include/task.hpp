@@ -4,6 +4,7 @@
 #define MODULES_CORE_INCLUDE_TASK_HPP_
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <memory>
@@ -51,7 +52,11 @@ class Task {
   std::shared_ptr<TaskData> taskData;
 
  private:
-  std::vector<std::string> functions_order;
+  // the order is checked call by call, so only the position in the cycle,
+  // the last call and the first violation are kept
+  std::size_t functions_called = 0;
+  std::string last_function;
+  std::string order_error;
   std::vector<std::string> right_functions_order = {"validation", "pre_processing", "run", "post_processing"};
   const double max_test_time = 1.0;
   std::chrono::high_resolution_clock::time_point tmp_time_point;
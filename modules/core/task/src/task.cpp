@@ -8,7 +8,9 @@
 
 void ppc::core::Task::set_data(std::shared_ptr<TaskData> taskData_) {
   taskData_->state_of_testing = TaskData::StateOfTesting::FUNC;
-  functions_order.clear();
+  functions_called = 0;
+  last_function.clear();
+  order_error.clear();
   taskData = std::move(taskData_);
 }
 
@@ -17,17 +19,17 @@ std::shared_ptr<ppc::core::TaskData> ppc::core::Task::get_data() const { return
 ppc::core::Task::Task(std::shared_ptr<TaskData> taskData_) { set_data(std::move(taskData_)); }
 
 void ppc::core::Task::internal_order_test(const std::string& str) {
-  if (!functions_order.empty() && str == functions_order.back() && str == "run") return;
-
-  functions_order.push_back(str);
-
-  for (size_t i = 0; i < functions_order.size(); i++) {
-    if (functions_order[i] != right_functions_order[i % right_functions_order.size()]) {
-      throw std::invalid_argument("ORDER OF FUCTIONS IS NOT RIGHT: \n" + std::string("Serial number: ") +
-                                  std::to_string(i + 1) + "\n" + std::string("Yours function: ") + functions_order[i] +
-                                  "\n" + std::string("Expected function: ") + right_functions_order[i]);
-    }
+  if (str == last_function && str == "run") return;
+  last_function = str;
+
+  const auto& expected = right_functions_order[functions_called % right_functions_order.size()];
+  if (order_error.empty() && str != expected) {
+    order_error = "ORDER OF FUCTIONS IS NOT RIGHT: \n" + std::string("Serial number: ") +
+                  std::to_string(functions_called + 1) + "\n" + std::string("Yours function: ") + str + "\n" +
+                  std::string("Expected function: ") + expected;
   }
+  functions_called++;
+  if (!order_error.empty()) throw std::invalid_argument(order_error);
 
   if (str == "pre_processing" && taskData->state_of_testing == TaskData::StateOfTesting::FUNC) {
     tmp_time_point = std::chrono::high_resolution_clock::now();
@@ -44,4 +46,4 @@ void ppc::core::Task::internal_order_test(const std::string& str) {
   }
 }
 
-ppc::core::Task::~Task() { functions_order.clear(); }
+ppc::core::Task::~Task() = default;
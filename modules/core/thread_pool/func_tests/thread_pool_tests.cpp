@@ -0,0 +1,183 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "core/thread_pool/include/thread_pool.hpp"
+#include "core/thread_pool/include/wait_policy.hpp"
+#include "core/thread_pool/include/work_stealing_deque.hpp"
+
+using namespace std::chrono_literals;
+
+namespace {
+
+const std::vector<ppc::core::WaitPolicy> policies = {ppc::core::WaitPolicy::spinning(),
+                                                     ppc::core::WaitPolicy::yielding(),
+                                                     ppc::core::WaitPolicy::parking(),
+                                                     ppc::core::WaitPolicy::adaptive(),
+                                                     {16, 2}};
+
+}  // namespace
+
+TEST(work_stealing_deque, check_owner_lifo_thief_fifo) {
+  std::vector<int> items(200);
+  // more items than the initial ring holds
+  ppc::core::WorkStealingDeque<int> deque(4);
+  for (auto& item : items) deque.push(&item);
+  EXPECT_EQ(deque.steal(), &items.front());
+  EXPECT_EQ(deque.pop(), &items.back());
+  for (std::size_t i = 1; i + 1 < items.size(); i++) EXPECT_EQ(deque.steal(), &items[i]);
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_EQ(deque.steal(), nullptr);
+}
+
+TEST(work_stealing_deque, check_every_item_is_taken_once) {
+  const std::size_t count = 100000;
+  std::vector<int> items(count);
+  std::vector<std::atomic<int>> taken(count);
+  ppc::core::WorkStealingDeque<int> deque(16);
+  std::atomic<bool> done{false};
+  auto take = [&](int* item) {
+    if (item != nullptr) taken[static_cast<std::size_t>(item - items.data())].fetch_add(1);
+  };
+
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < 3; t++) {
+    thieves.emplace_back([&] {
+      while (!done.load() || !deque.empty()) take(deque.steal());
+    });
+  }
+  // the owner pops every third push, so pops and steals race for the last items
+  for (std::size_t i = 0; i < count; i++) {
+    deque.push(&items[i]);
+    if (i % 3 == 0) take(deque.pop());
+  }
+  while (!deque.empty()) take(deque.pop());
+  done.store(true);
+  for (auto& thief : thieves) thief.join();
+
+  for (std::size_t i = 0; i < count; i++) ASSERT_EQ(taken[i].load(), 1) << "item " << i;
+}
+
+TEST(thread_pool, check_every_index_runs_once) {
+  ppc::core::ThreadPool pool(3);
+  for (std::size_t count : {0, 1, 2, 7, 64, 1000}) {
+    std::vector<std::atomic<int>> calls(count);
+    pool.parallel_for(count, [&](std::size_t i) { calls[i].fetch_add(1); });
+    for (std::size_t i = 0; i < count; i++) EXPECT_EQ(calls[i].load(), 1) << "count = " << count;
+  }
+}
+
+TEST(thread_pool, check_threads_are_reused) {
+  ppc::core::ThreadPool pool(3);
+  std::mutex mutex;
+  std::set<std::thread::id> ids;
+  for (int round = 0; round < 20; round++) {
+    pool.parallel_for(8, [&](std::size_t) {
+      std::this_thread::sleep_for(1ms);
+      std::lock_guard<std::mutex> lock(mutex);
+      ids.insert(std::this_thread::get_id());
+    });
+  }
+  // the caller and the three workers, nobody else
+  EXPECT_GT(ids.size(), 1U);
+  EXPECT_LE(ids.size(), 4U);
+}
+
+TEST(thread_pool, check_nested_parallel_for) {
+  ppc::core::ThreadPool pool(3);
+  std::atomic<std::size_t> sum{0};
+  pool.parallel_for(8, [&](std::size_t i) { pool.parallel_for(100, [&](std::size_t j) { sum += i * 100 + j; }); });
+  EXPECT_EQ(sum.load(), 800U * 799U / 2U);
+}
+
+TEST(thread_pool, check_exception_is_rethrown) {
+  ppc::core::ThreadPool pool(2);
+  std::atomic<int> calls{0};
+  EXPECT_THROW(pool.parallel_for(16,
+                                 [&](std::size_t i) {
+                                   calls++;
+                                   if (i == 5) throw std::runtime_error("body failed");
+                                 }),
+               std::runtime_error);
+  // the other calls still ran and the pool keeps working
+  EXPECT_EQ(calls.load(), 16);
+  pool.parallel_for(16, [&](std::size_t) { calls++; });
+  EXPECT_EQ(calls.load(), 32);
+}
+
+TEST(thread_pool, check_pool_without_workers) {
+  ppc::core::ThreadPool pool(0);
+  std::vector<std::thread::id> ids(5);
+  pool.parallel_for(ids.size(), [&](std::size_t i) { ids[i] = std::this_thread::get_id(); });
+  for (auto id : ids) EXPECT_EQ(id, std::this_thread::get_id());
+}
+
+TEST(thread_pool, check_shared_instance) {
+  auto& pool = ppc::core::ThreadPool::instance();
+  EXPECT_EQ(&pool, &ppc::core::ThreadPool::instance());
+  EXPECT_EQ(pool.workers() + 1, std::max(std::thread::hardware_concurrency(), 1U));
+}
+
+TEST(wait_policy, check_spin_wait_budget) {
+  int calls = 0;
+  EXPECT_FALSE(ppc::core::spin_wait({3, 2}, [&] { return ++calls < 0; }));
+  // one look per round of both phases and a last one
+  EXPECT_EQ(calls, 6);
+  calls = 0;
+  EXPECT_TRUE(ppc::core::spin_wait(ppc::core::WaitPolicy::spinning(), [&] { return ++calls == 1000; }));
+  EXPECT_EQ(calls, 1000);
+  EXPECT_FALSE(ppc::core::spin_wait(ppc::core::WaitPolicy::parking(), [] { return false; }));
+}
+
+TEST(wait_policy, check_wait_word_wakes_up) {
+  for (const auto& policy : policies) {
+    ppc::core::WaitWord word;
+    std::atomic<int> woken{0};
+    std::vector<std::thread> waiters;
+    for (int w = 0; w < 3; w++) {
+      waiters.emplace_back([&] {
+        // returns on the change of the word, tolerating early returns
+        while (word.load() == 0) word.wait(0, policy, [] { return false; });
+        woken++;
+      });
+    }
+    std::this_thread::sleep_for(5ms);
+    EXPECT_EQ(woken.load(), 0);
+    word.notify_all();
+    for (auto& waiter : waiters) waiter.join();
+    EXPECT_EQ(woken.load(), 3);
+  }
+}
+
+TEST(wait_policy, check_wait_word_stops_on_ready) {
+  ppc::core::WaitWord word;
+  std::atomic<bool> ready{false};
+  std::thread waiter([&] { word.wait(0, ppc::core::WaitPolicy::yielding(), [&] { return ready.load(); }); });
+  ready.store(true);
+  waiter.join();
+  EXPECT_EQ(word.load(), 0U);
+}
+
+TEST(thread_pool, check_every_wait_policy) {
+  for (const auto& policy : policies) {
+    ppc::core::ThreadPool pool(3, policy);
+    EXPECT_EQ(pool.wait_policy().spins, policy.spins);
+    for (int round = 0; round < 20; round++) {
+      std::vector<std::atomic<int>> calls(100);
+      pool.parallel_for(calls.size(), [&](std::size_t i) { calls[i]++; });
+      for (auto& c : calls) ASSERT_EQ(c.load(), 1);
+      // long enough for the adaptive workers to park
+      if (round % 5 == 0) std::this_thread::sleep_for(2ms);
+    }
+  }
+}
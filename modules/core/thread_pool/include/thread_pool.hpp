@@ -0,0 +1,79 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_THREAD_POOL_HPP_
+#define MODULES_CORE_INCLUDE_THREAD_POOL_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "core/thread_pool/include/wait_policy.hpp"
+
+namespace ppc::core {
+
+// Persistent fork-join pool of std::threads. Every worker owns a Chase-Lev
+// deque (core/thread_pool/include/work_stealing_deque.hpp): parallel_for
+// splits its index range in halves, pushes the right halves to the deque of
+// the splitting thread and runs the left ones, and idle workers steal the
+// oldest halves. Workers with nothing to steal, and callers waiting for the
+// stolen halves, wait as the WaitPolicy of the pool says, so with a parking
+// policy a pool costs nothing between tasks. Threads are never created in the
+// timed region.
+class ThreadPool {
+ public:
+  // starts workers background threads, the thread that calls parallel_for
+  // always works too
+  explicit ThreadPool(std::size_t workers, const WaitPolicy& policy = WaitPolicy::adaptive());
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  // The pool shared by all STL tasks: hardware_concurrency() - 1 workers,
+  // started on first use and kept until the program exits
+  static ThreadPool& instance();
+
+  [[nodiscard]] std::size_t workers() const;
+  [[nodiscard]] const WaitPolicy& wait_policy() const { return policy_; }
+
+  // Calls body(i) for every i in [0, count) and returns when all the calls are
+  // done. May be called from inside a body; the first exception thrown by a
+  // body is rethrown after the other calls finish.
+  template <class Body>
+  void parallel_for(std::size_t count, const Body& body) {
+    run(count, [](const void* context, std::size_t i) { (*static_cast<const Body*>(context))(i); }, &body);
+  }
+
+ private:
+  using Invoke = void (*)(const void*, std::size_t);
+  struct Group;
+  struct Job;
+  struct Worker;
+
+  void run(std::size_t count, Invoke invoke, const void* context);
+  void work(Worker& self);
+  void execute(Job* job, Worker* self);
+  void push(Job* job, Worker* self);
+  Job* find_job(Worker* self);
+  Worker* current_worker();
+
+  WaitPolicy policy_;
+  std::vector<std::unique_ptr<Worker>> workers_;
+  // jobs pushed by threads that are not workers of this pool
+  std::mutex injection_mutex_;
+  std::deque<Job*> injection_;
+  std::atomic<std::size_t> injected_{0};
+  // bumped on every push, idle workers wait for it to change
+  WaitWord pushes_;
+  // bumped whenever a parallel_for finishes, its caller waits for it
+  WaitWord completions_;
+  std::atomic<bool> stop_{false};
+};
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_THREAD_POOL_HPP_
@@ -0,0 +1,107 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_WAIT_POLICY_HPP_
+#define MODULES_CORE_INCLUDE_WAIT_POLICY_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <thread>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace ppc::core {
+
+// How an idle thread waits for something to change: first spin with a pause
+// instruction, then give the core away with std::this_thread::yield(), then
+// park in the kernel (a futex on Linux) until it is woken. Spinning wakes up
+// in nanoseconds but keeps a core busy, parking costs nothing while idle but
+// a system call and a reschedule to wake up.
+struct WaitPolicy {
+  // a budget that never runs out: the next phase is never reached
+  static constexpr std::uint32_t kForever = std::numeric_limits<std::uint32_t>::max();
+
+  // rounds of cpu_relax() before yielding
+  std::uint32_t spins = 0;
+  // rounds of std::this_thread::yield() before parking
+  std::uint32_t yields = 0;
+
+  // Spins until woken
+  static constexpr WaitPolicy spinning() { return {kForever, 0}; }
+  // Yields until woken
+  static constexpr WaitPolicy yielding() { return {0, kForever}; }
+  // Parks at once
+  static constexpr WaitPolicy parking() { return {0, 0}; }
+  // Spins through a short fork-join gap, yields through a longer one and
+  // parks once the thread has been idle for a while; the default of the pools
+  static constexpr WaitPolicy adaptive() { return {2048, 64}; }
+};
+
+// One round of a spin loop: tells the core that the thread is waiting, so
+// that it saves power and leaves the pipeline to the other hyperthread
+inline void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  asm volatile("yield");
+#endif
+}
+
+// Spins and yields as policy says until ready() holds; false if the budget
+// of both phases ran out first
+template <class Ready>
+bool spin_wait(const WaitPolicy& policy, const Ready& ready) {
+  for (std::uint32_t i = 0; policy.spins == WaitPolicy::kForever || i < policy.spins; i++) {
+    if (ready()) return true;
+    cpu_relax();
+  }
+  for (std::uint32_t i = 0; policy.yields == WaitPolicy::kForever || i < policy.yields; i++) {
+    if (ready()) return true;
+    std::this_thread::yield();
+  }
+  return ready();
+}
+
+// A counter that threads wait on for a change. It keeps track of the parked
+// threads, so a notify costs no system call while nobody is parked.
+class WaitWord {
+ public:
+  [[nodiscard]] std::uint32_t load() const { return word_.load(std::memory_order_seq_cst); }
+
+  // Waits as policy says until the counter differs from old or ready()
+  // holds. May return early, callers check what they wait for in a loop.
+  template <class Ready>
+  void wait(std::uint32_t old, const WaitPolicy& policy, const Ready& ready) {
+    if (spin_wait(policy, [&] { return word_.load(std::memory_order_acquire) != old || ready(); })) return;
+    // announce the park before the last look, a notify after it sees parked_
+    parked_.fetch_add(1, std::memory_order_seq_cst);
+    if (word_.load(std::memory_order_seq_cst) == old && !ready()) park(old);
+    parked_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  // Bumps the counter and wakes one or all of the parked threads
+  void notify_one() { notify(false); }
+  void notify_all() { notify(true); }
+
+ private:
+  void notify(bool all) {
+    word_.fetch_add(1, std::memory_order_seq_cst);
+    if (parked_.load(std::memory_order_seq_cst) != 0) wake(all);
+  }
+
+  // sleep while word_ == old, and the matching wake-up; futex on Linux and
+  // std::atomic wait elsewhere
+  void park(std::uint32_t old);
+  void wake(bool all);
+
+  std::atomic<std::uint32_t> word_{0};
+  std::atomic<std::uint32_t> parked_{0};
+};
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_WAIT_POLICY_HPP_
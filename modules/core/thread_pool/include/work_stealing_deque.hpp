@@ -0,0 +1,111 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_WORK_STEALING_DEQUE_HPP_
+#define MODULES_CORE_INCLUDE_WORK_STEALING_DEQUE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ppc::core {
+
+// Chase-Lev work-stealing deque of pointers (with the memory orders of Le et
+// al., "Correct and Efficient Work-Stealing for Weak Memory Models"). The
+// owner thread pushes and pops at the bottom, any other thread steals from the
+// top. The ring doubles when it is full; replaced rings are kept until the
+// deque is destroyed, because a thief may still be reading one.
+template <class T>
+class WorkStealingDeque {
+ public:
+  // capacity has to be a power of two
+  explicit WorkStealingDeque(std::size_t capacity = 64) {
+    rings_.push_back(std::make_unique<Ring>(capacity));
+    ring_.store(rings_.back().get(), std::memory_order_relaxed);
+  }
+
+  WorkStealingDeque(const WorkStealingDeque&) = delete;
+  WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+  // owner only
+  void push(T* item) {
+    const int64_t b = bottom_.load(std::memory_order_relaxed);
+    const int64_t t = top_.load(std::memory_order_acquire);
+    Ring* ring = ring_.load(std::memory_order_relaxed);
+    if (b - t > static_cast<int64_t>(ring->mask)) ring = grow(ring, t, b);
+    ring->put(b, item);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(b + 1, std::memory_order_relaxed);
+  }
+
+  // owner only, the most recently pushed item or nullptr
+  T* pop() {
+    const int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+    Ring* ring = ring_.load(std::memory_order_relaxed);
+    bottom_.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top_.load(std::memory_order_relaxed);
+    if (t > b) {
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    T* item = ring->get(b);
+    if (t == b) {
+      // the last item, thieves race for it through top
+      if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        item = nullptr;
+      }
+      bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+    return item;
+  }
+
+  // any thread, the oldest item or nullptr when the deque is empty or another
+  // thread took the item first
+  T* steal() {
+    int64_t t = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int64_t b = bottom_.load(std::memory_order_acquire);
+    if (t >= b) return nullptr;
+    T* item = ring_.load(std::memory_order_acquire)->get(t);
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      return nullptr;
+    }
+    return item;
+  }
+
+  // a snapshot, exact only when no other thread uses the deque
+  [[nodiscard]] bool empty() const {
+    return bottom_.load(std::memory_order_acquire) <= top_.load(std::memory_order_acquire);
+  }
+
+ private:
+  struct Ring {
+    explicit Ring(std::size_t capacity) : mask(capacity - 1), items(capacity) {}
+    T* get(int64_t i) const { return items[static_cast<std::size_t>(i) & mask].load(std::memory_order_relaxed); }
+    void put(int64_t i, T* item) { items[static_cast<std::size_t>(i) & mask].store(item, std::memory_order_relaxed); }
+
+    std::size_t mask;
+    std::vector<std::atomic<T*>> items;
+  };
+
+  Ring* grow(Ring* ring, int64_t t, int64_t b) {
+    auto bigger = std::make_unique<Ring>(2 * (ring->mask + 1));
+    for (int64_t i = t; i < b; i++) bigger->put(i, ring->get(i));
+    ring = bigger.get();
+    rings_.push_back(std::move(bigger));
+    ring_.store(ring, std::memory_order_release);
+    return ring;
+  }
+
+  // top and bottom are written by different threads
+  alignas(64) std::atomic<int64_t> top_{0};
+  alignas(64) std::atomic<int64_t> bottom_{0};
+  std::atomic<Ring*> ring_;
+  std::vector<std::unique_ptr<Ring>> rings_;
+};
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_WORK_STEALING_DEQUE_HPP_
@@ -0,0 +1,149 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/perf/include/timer.hpp"
+#include "core/task/include/task.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+#include "core/thread_pool/include/wait_policy.hpp"
+
+namespace {
+
+// busy time of every parallel_for body, long enough for a late worker to
+// still find a half to steal
+constexpr std::int64_t kBodyNs = 100000;
+constexpr double kMeasureSeconds = 0.1;
+
+const std::vector<std::pair<std::string, ppc::core::WaitPolicy>> policies = {
+    {"spinning", ppc::core::WaitPolicy::spinning()},
+    {"yielding", ppc::core::WaitPolicy::yielding()},
+    {"parking", ppc::core::WaitPolicy::parking()},
+    {"adaptive", ppc::core::WaitPolicy::adaptive()}};
+
+std::int64_t now_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// One fork-join of workers + 1 bodies per run(). Keeps how long after the
+// fork the first worker started a body, the wake-up latency.
+class ForkJoinTask : public ppc::core::Task {
+ public:
+  ForkJoinTask(std::shared_ptr<ppc::core::TaskData> taskData_, ppc::core::ThreadPool& pool)
+      : Task(std::move(taskData_)), pool_(pool) {}
+
+  bool validation() override {
+    internal_order_test();
+    return pool_.workers() > 0;
+  }
+
+  bool pre_processing() override {
+    internal_order_test();
+    return true;
+  }
+
+  bool run() override {
+    internal_order_test();
+    const auto caller = std::this_thread::get_id();
+    std::atomic<std::int64_t> first_worker{std::numeric_limits<std::int64_t>::max()};
+    const std::int64_t fork = now_ns();
+    pool_.parallel_for(pool_.workers() + 1, [&](std::size_t) {
+      const std::int64_t start = now_ns();
+      if (std::this_thread::get_id() != caller) {
+        auto first = first_worker.load();
+        while (start < first && !first_worker.compare_exchange_weak(first, start)) {
+        }
+      }
+      while (now_ns() - start < kBodyNs) {
+      }
+    });
+    forks_++;
+    if (first_worker.load() != std::numeric_limits<std::int64_t>::max()) {
+      woken_++;
+      wake_ns_ += first_worker.load() - fork;
+    }
+    return true;
+  }
+
+  bool post_processing() override {
+    internal_order_test();
+    return true;
+  }
+
+  void reset() { forks_ = woken_ = wake_ns_ = 0; }
+  // the share of fork-joins a worker took part in
+  [[nodiscard]] double woken_share() const { return forks_ == 0 ? 0.0 : static_cast<double>(woken_) / forks_; }
+  [[nodiscard]] double wake_latency_us() const { return woken_ == 0 ? 0.0 : 1e-3 * wake_ns_ / woken_; }
+
+ private:
+  ppc::core::ThreadPool& pool_;
+  std::int64_t forks_ = 0;
+  std::int64_t woken_ = 0;
+  std::int64_t wake_ns_ = 0;
+};
+
+// Times fork-joins of a pool with every policy, after an untimed pause of
+// gap between them. Prints per policy the time, the mean fork-join, the wake-up latency, the
+// share of fork-joins the workers woke up for and the CPU burn: the cores
+// kept busy over the whole measurement, the pauses included.
+void run_wait_policy_perf(const std::string& scenario, std::chrono::microseconds gap) {
+  const std::size_t workers = std::max(std::thread::hardware_concurrency(), 2U) - 1;
+  for (const auto& [name, policy] : policies) {
+    ppc::core::ThreadPool pool(workers, policy);
+    auto task = std::make_shared<ForkJoinTask>(std::make_shared<ppc::core::TaskData>(), pool);
+    ppc::core::Perf perfAnalyzer(task);
+    auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+    perfAttr->fixture.set_up_iteration = [gap] { std::this_thread::sleep_for(gap); };
+    auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+    // calibrate on a few fork-joins with the pauses in between
+    perfAttr->num_running = 8;
+    perfAnalyzer.task_run(perfAttr, perfResults);
+
+    double cpu_begin = 0.0;
+    double wall_begin = 0.0;
+    do {
+      // again with more fork-joins if the calibration run was slow
+      perfAttr->num_running = std::max<uint64_t>(
+          perfAttr->num_running,
+          static_cast<uint64_t>(std::ceil(kMeasureSeconds / std::max(perfResults->time_sec, kMeasureSeconds / 100) *
+                                          static_cast<double>(perfAttr->num_running))));
+      task->reset();
+      cpu_begin = ppc::core::timer::process_cpu();
+      wall_begin = ppc::core::timer::steady();
+      perfAnalyzer.task_run(perfAttr, perfResults);
+    } while (perfResults->time_sec < kMeasureSeconds / 2);
+    const double cpu = ppc::core::timer::process_cpu() - cpu_begin;
+    const double wall = ppc::core::timer::steady() - wall_begin;
+
+    const std::string case_name = name + "/" + scenario;
+    ppc::core::Perf::print_perf_statistic(perfResults, case_name);
+    ppc::core::Perf::print_perf_metric(case_name, "fork_join_us",
+                                       1e6 * perfResults->time_sec / static_cast<double>(perfAttr->num_running));
+    ppc::core::Perf::print_perf_metric(case_name, "wake_latency_us", task->wake_latency_us());
+    ppc::core::Perf::print_perf_metric(case_name, "woken_share", task->woken_share());
+    ppc::core::Perf::print_perf_metric(case_name, "cpu_burn_cores", cpu / wall);
+  }
+}
+
+}  // namespace
+
+TEST(wait_policy_perf_tests, test_back_to_back_fork_join) { run_wait_policy_perf("back_to_back", {}); }
+
+TEST(wait_policy_perf_tests, test_fork_join_after_idle) {
+  // longer than the spin and yield budgets of the adaptive policy
+  run_wait_policy_perf("after_idle", std::chrono::milliseconds(1));
+}
@@ -0,0 +1,168 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/thread_pool/include/thread_pool.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <utility>
+
+#include "core/thread_pool/include/work_stealing_deque.hpp"
+
+// One parallel_for call, lives on the stack of its caller
+struct ppc::core::ThreadPool::Group {
+  Group(Invoke invoke_, const void* context_, std::size_t count)
+      : invoke(invoke_), context(context_), jobs(count), pending(count) {}
+
+  Invoke invoke;
+  const void* context;
+  // a job per index: the root plus one per split
+  std::vector<Job> jobs;
+  std::atomic<std::size_t> next_job{1};
+  std::atomic<std::size_t> pending;
+  std::mutex error_mutex;
+  std::exception_ptr error;
+};
+
+// Indices [begin, end) of a group that nobody has started yet
+struct ppc::core::ThreadPool::Job {
+  Group* group;
+  std::size_t begin;
+  std::size_t end;
+};
+
+struct ppc::core::ThreadPool::Worker {
+  ThreadPool* pool;
+  std::size_t index;
+  WorkStealingDeque<Job> deque;
+  std::thread thread;
+};
+
+namespace {
+
+// the worker running on this thread, nullptr for threads outside every pool
+thread_local void* current = nullptr;
+
+}  // namespace
+
+ppc::core::ThreadPool::ThreadPool(std::size_t workers, const WaitPolicy& policy) : policy_(policy) {
+  // all deques exist before any thread starts stealing from them
+  for (std::size_t w = 0; w < workers; w++) {
+    workers_.push_back(std::make_unique<Worker>());
+    workers_.back()->pool = this;
+    workers_.back()->index = w;
+  }
+  for (auto& worker : workers_) {
+    worker->thread = std::thread([this, self = worker.get()] { work(*self); });
+  }
+}
+
+ppc::core::ThreadPool::~ThreadPool() {
+  stop_.store(true, std::memory_order_seq_cst);
+  pushes_.notify_all();
+  for (auto& worker : workers_) worker->thread.join();
+}
+
+ppc::core::ThreadPool& ppc::core::ThreadPool::instance() {
+  static ThreadPool pool(std::max(std::thread::hardware_concurrency(), 1U) - 1);
+  return pool;
+}
+
+std::size_t ppc::core::ThreadPool::workers() const { return workers_.size(); }
+
+ppc::core::ThreadPool::Worker* ppc::core::ThreadPool::current_worker() {
+  auto* worker = static_cast<Worker*>(current);
+  return worker != nullptr && worker->pool == this ? worker : nullptr;
+}
+
+void ppc::core::ThreadPool::run(std::size_t count, Invoke invoke, const void* context) {
+  if (count == 0) return;
+  if (count == 1 || workers_.empty()) {
+    for (std::size_t i = 0; i < count; i++) invoke(context, i);
+    return;
+  }
+
+  Group group(invoke, context, count);
+  group.jobs[0] = {&group, 0, count};
+  Worker* self = current_worker();
+  execute(group.jobs.data(), self);
+  // help with the remaining indices (or any other work) until they are done
+  while (group.pending.load(std::memory_order_acquire) != 0) {
+    if (Job* job = find_job(self)) {
+      execute(job, self);
+      continue;
+    }
+    const auto completions = completions_.load();
+    if (group.pending.load(std::memory_order_acquire) == 0) break;
+    completions_.wait(completions, policy_, [&] { return group.pending.load(std::memory_order_acquire) == 0; });
+  }
+  if (group.error) std::rethrow_exception(group.error);
+}
+
+void ppc::core::ThreadPool::execute(Job* job, Worker* self) {
+  Group& group = *job->group;
+  std::size_t begin = job->begin;
+  std::size_t end = job->end;
+  // keep the left half, offer the right one to the thieves
+  while (end - begin > 1) {
+    const std::size_t mid = begin + (end - begin) / 2;
+    Job* right = &group.jobs[group.next_job.fetch_add(1, std::memory_order_relaxed)];
+    *right = {&group, mid, end};
+    push(right, self);
+    end = mid;
+  }
+  try {
+    group.invoke(group.context, begin);
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(group.error_mutex);
+    if (!group.error) group.error = std::current_exception();
+  }
+  // the group may be destroyed by its caller as soon as pending reaches zero
+  if (group.pending.fetch_sub(1, std::memory_order_acq_rel) == 1) completions_.notify_all();
+}
+
+void ppc::core::ThreadPool::push(Job* job, Worker* self) {
+  if (self != nullptr) {
+    self->deque.push(job);
+  } else {
+    std::lock_guard<std::mutex> lock(injection_mutex_);
+    injection_.push_back(job);
+    injected_.fetch_add(1, std::memory_order_relaxed);
+  }
+  pushes_.notify_one();
+}
+
+ppc::core::ThreadPool::Job* ppc::core::ThreadPool::find_job(Worker* self) {
+  if (self != nullptr) {
+    if (Job* job = self->deque.pop()) return job;
+  }
+  if (injected_.load(std::memory_order_relaxed) != 0) {
+    std::lock_guard<std::mutex> lock(injection_mutex_);
+    if (!injection_.empty()) {
+      Job* job = injection_.front();
+      injection_.pop_front();
+      injected_.fetch_sub(1, std::memory_order_relaxed);
+      return job;
+    }
+  }
+  // start at the next worker, so thieves spread over the victims
+  const std::size_t first = self != nullptr ? self->index + 1 : 0;
+  for (std::size_t k = 0; k < workers_.size(); k++) {
+    Worker& victim = *workers_[(first + k) % workers_.size()];
+    if (&victim == self) continue;
+    if (Job* job = victim.deque.steal()) return job;
+  }
+  return nullptr;
+}
+
+void ppc::core::ThreadPool::work(Worker& self) {
+  current = &self;
+  while (!stop_.load(std::memory_order_acquire)) {
+    // read before the last look, a push after it changes the word
+    const auto pushes = pushes_.load();
+    if (Job* job = find_job(&self)) {
+      execute(job, &self);
+      continue;
+    }
+    pushes_.wait(pushes, policy_, [this] { return stop_.load(std::memory_order_acquire); });
+  }
+}
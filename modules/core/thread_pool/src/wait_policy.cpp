@@ -0,0 +1,46 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/thread_pool/include/wait_policy.hpp"
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <climits>
+#endif
+
+#if defined(__linux__)
+
+namespace {
+
+// the futex system call takes the address of a plain 32-bit word
+static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t) &&
+                  std::atomic<std::uint32_t>::is_always_lock_free,
+              "std::atomic<std::uint32_t> must be a plain 32-bit word");
+
+void futex(std::atomic<std::uint32_t>* word, int op, std::uint32_t value) {
+  syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(word), op, value, nullptr, nullptr, 0);
+}
+
+}  // namespace
+
+void ppc::core::WaitWord::park(std::uint32_t old) {
+  // returns at once if word_ changed meanwhile, so a wake-up is never lost
+  futex(&word_, FUTEX_WAIT_PRIVATE, old);
+}
+
+void ppc::core::WaitWord::wake(bool all) { futex(&word_, FUTEX_WAKE_PRIVATE, all ? INT_MAX : 1); }
+
+#else
+
+void ppc::core::WaitWord::park(std::uint32_t old) { word_.wait(old, std::memory_order_seq_cst); }
+
+void ppc::core::WaitWord::wake(bool all) {
+  if (all) {
+    word_.notify_all();
+  } else {
+    word_.notify_one();
+  }
+}
+
+#endif
@@ -1,10 +1,45 @@
 // Copyright 2023 Nesterov Alexander
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <random>
 #include <vector>
 
 #include "core/task/include/task.hpp"
 #include "ref/average_of_vector_elements/include/ref_task.hpp"
+#include "ref/kernels/func_tests/test_utils.hpp"
+
+namespace {
+
+template <class Policy>
+void check_policy_matches_seq() {
+  // Create data
+  const size_t count = 100000;
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int32_t> dist(-1000, 1000);
+  std::vector<int32_t> in(count);
+  for (auto& elem : in) elem = dist(gen);
+  std::vector<double> out_seq(1, 0), out_par(1, 0);
+
+  auto make_task_data = [&](std::vector<double>& out) {
+    std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+    taskData->inputs_count.emplace_back(in.size());
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+    taskData->outputs_count.emplace_back(out.size());
+    return taskData;
+  };
+
+  // Create Task
+  ppc::reference::AverageOfVectorElements<int32_t, double> seqTask(make_task_data(out_seq));
+  ppc::reference::AverageOfVectorElements<int32_t, double, Policy> parTask(make_task_data(out_par));
+  ppc::reference::test::run_task(seqTask);
+  ppc::reference::test::ScopedConcurrency split;
+  ppc::reference::test::run_task(parTask);
+  EXPECT_EQ(out_par, out_seq);
+}
+
+}  // namespace
 
 TEST(average_of_vector_elements, check_int32_t) {
   // Create data
@@ -112,6 +147,28 @@ TEST(average_of_vector_elements, check_int64_t) {
   EXPECT_NEAR(out[0], 3.0, 1e-5);
 }
 
+TEST(average_of_vector_elements, check_int64_t_does_not_overflow) {
+  // Create data
+  std::vector<int64_t> in(2, INT64_MAX);
+  std::vector<double> out(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  ppc::reference::AverageOfVectorElements<int64_t, double> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  EXPECT_DOUBLE_EQ(out[0], static_cast<double>(INT64_MAX));
+}
+
 TEST(average_of_vector_elements, check_float) {
   // Create data
   std::vector<float> in(1, 1.5f);
@@ -133,3 +190,36 @@ TEST(average_of_vector_elements, check_float) {
   testTask.post_processing();
   EXPECT_NEAR(out[0], 1.5, 1e-5);
 }
+
+TEST(average_of_vector_elements, check_int8_t_widening) {
+  // Create data
+  std::vector<int8_t> in(100000, -128);
+  std::vector<double> out(1, 0);
+  for (size_t i = 0; i < in.size(); i += 2) {
+    in[i] = 127;
+  }
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  ppc::reference::AverageOfVectorElements<int8_t, double> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  EXPECT_DOUBLE_EQ(out[0], -0.5);
+}
+
+TEST(average_of_vector_elements, check_omp_matches_seq) { check_policy_matches_seq<ppc::reference::exec::omp>(); }
+
+TEST(average_of_vector_elements, check_tbb_matches_seq) { check_policy_matches_seq<ppc::reference::exec::tbb>(); }
+
+TEST(average_of_vector_elements, check_stl_matches_seq) { check_policy_matches_seq<ppc::reference::exec::stl>(); }
+
+TEST(average_of_vector_elements, check_mpi_matches_seq) { check_policy_matches_seq<ppc::reference::exec::mpi>(); }
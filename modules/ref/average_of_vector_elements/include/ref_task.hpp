@@ -6,26 +6,23 @@
 #include <gtest/gtest.h>
 
 #include <memory>
-#include <numeric>
-#include <vector>
 
 #include "core/task/include/task.hpp"
+#include "ref/kernels/include/accumulator.hpp"
+#include "ref/kernels/include/parallel.hpp"
+#include "ref/kernels/include/reduce.hpp"
 
 namespace ppc {
 namespace reference {
 
-template <class InType, class OutType>
+template <class InType, class OutType, class Policy = exec::seq>
 class AverageOfVectorElements : public ppc::core::Task {
  public:
   explicit AverageOfVectorElements(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(taskData_) {}
   bool pre_processing() override {
     internal_order_test();
-    // Init vectors
-    input_ = std::vector<InType>(taskData->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InType*>(taskData->inputs[0]);
-    for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // Init input, the kernels read it in place
+    input_ = reinterpret_cast<InType*>(taskData->inputs[0]);
     // Init value for output
     average = 0.0;
     return true;
@@ -39,7 +36,8 @@ class AverageOfVectorElements : public ppc::core::Task {
 
   bool run() override {
     internal_order_test();
-    average = static_cast<OutType>(std::accumulate(input_.begin(), input_.end(), 0.0));
+    using Acc = kernels::average_accumulator_t<InType>;
+    average = static_cast<OutType>(kernels::parallel_sum<Policy, InType, Acc>(input_, taskData->inputs_count[0]));
     average /= static_cast<OutType>(taskData->inputs_count[0]);
     return true;
   }
@@ -51,7 +49,7 @@ class AverageOfVectorElements : public ppc::core::Task {
   }
 
  private:
-  std::vector<InType> input_;
+  const InType* input_{};
   OutType average;
 };
 
@@ -0,0 +1,150 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "ref/kernels/func_tests/test_utils.hpp"
+#include "ref/file_reductions/include/ref_task.hpp"
+
+namespace {
+
+template <class T>
+std::string write_file(const std::string& name, const std::vector<T>& vec) {
+  auto path = ppc::reference::test::temp_path(name);
+  std::ofstream(path, std::ios::binary)
+      .write(reinterpret_cast<const char*>(vec.data()), static_cast<std::streamsize>(vec.size() * sizeof(T)));
+  return path;
+}
+
+// TaskData reading the file at path and writing to the outputs
+std::shared_ptr<ppc::core::TaskData> make_task_data(std::string& path, std::vector<std::vector<uint8_t>>& outputs) {
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(path.data()));
+  taskData->inputs_count.emplace_back(path.size());
+  for (auto& out : outputs) {
+    taskData->outputs.emplace_back(out.data());
+    taskData->outputs_count.emplace_back(1);
+  }
+  return taskData;
+}
+
+template <class Policy>
+void check_policy_matches_seq() {
+  // Create data
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int32_t> dist(-1000, 1000);
+  std::vector<int32_t> in(100000);
+  for (auto& elem : in) elem = dist(gen);
+  auto path = write_file("ppc_file_reductions_backends.bin", in);
+  std::vector<std::vector<uint8_t>> sum_seq(1, std::vector<uint8_t>(sizeof(int64_t))), sum_par = sum_seq;
+  std::vector<std::vector<uint8_t>> max_seq(2, std::vector<uint8_t>(sizeof(int64_t))), max_par = max_seq;
+
+  // Create Task
+  ppc::reference::FileSum<int32_t, int64_t> seqSumTask(make_task_data(path, sum_seq));
+  ppc::reference::FileSum<int32_t, int64_t, Policy> parSumTask(make_task_data(path, sum_par));
+  ppc::reference::FileMax<int32_t, uint64_t> seqMaxTask(make_task_data(path, max_seq));
+  ppc::reference::FileMax<int32_t, uint64_t, Policy> parMaxTask(make_task_data(path, max_par));
+  ppc::reference::test::run_task(seqSumTask);
+  ppc::reference::test::run_task(seqMaxTask);
+  ppc::reference::test::ScopedConcurrency split;
+  ppc::reference::test::run_task(parSumTask);
+  ppc::reference::test::run_task(parMaxTask);
+  EXPECT_EQ(sum_par, sum_seq);
+  EXPECT_EQ(max_par, max_seq);
+  std::filesystem::remove(path);
+}
+
+}  // namespace
+
+TEST(file_reductions, check_sum_and_average_int32_t) {
+  // Create data
+  std::vector<int32_t> in(100000);
+  for (size_t i = 0; i < in.size(); i++) in[i] = static_cast<int32_t>(i % 1000) - 300;
+  auto path = write_file("ppc_file_reductions_int32.bin", in);
+  std::vector<std::vector<uint8_t>> sum(1, std::vector<uint8_t>(sizeof(int64_t)));
+  std::vector<std::vector<uint8_t>> average(1, std::vector<uint8_t>(sizeof(double)));
+
+  // Create Task
+  ppc::reference::FileSum<int32_t, int64_t, ppc::reference::exec::stl> sumTask(make_task_data(path, sum));
+  ppc::reference::FileAverage<int32_t, double> averageTask(make_task_data(path, average));
+  ppc::reference::test::run_task(sumTask);
+  ppc::reference::test::run_task(averageTask);
+  EXPECT_EQ(reinterpret_cast<int64_t*>(sum[0].data())[0], 19950000);
+  EXPECT_DOUBLE_EQ(reinterpret_cast<double*>(average[0].data())[0], 199.5);
+  std::filesystem::remove(path);
+}
+
+TEST(file_reductions, check_average_int64_t_does_not_overflow) {
+  // Create data
+  auto path = write_file("ppc_file_reductions_int64.bin", std::vector<int64_t>(2, INT64_MAX));
+  std::vector<std::vector<uint8_t>> average(1, std::vector<uint8_t>(sizeof(double)));
+
+  // Create Task
+  ppc::reference::FileAverage<int64_t, double> averageTask(make_task_data(path, average));
+  ppc::reference::test::run_task(averageTask);
+  EXPECT_DOUBLE_EQ(reinterpret_cast<double*>(average[0].data())[0], static_cast<double>(INT64_MAX));
+  std::filesystem::remove(path);
+}
+
+TEST(file_reductions, check_min_max_double) {
+  // Create data
+  std::vector<double> in(50000, 1.0);
+  in[123] = -5.0;
+  in[40000] = -5.0;
+  in[777] = 8.0;
+  auto path = write_file("ppc_file_reductions_double.bin", in);
+  std::vector<std::vector<uint8_t>> min(2, std::vector<uint8_t>(sizeof(double)));
+  std::vector<std::vector<uint8_t>> max(2, std::vector<uint8_t>(sizeof(double)));
+
+  // Create Task
+  ppc::reference::FileMin<double, uint64_t, ppc::reference::exec::omp> minTask(make_task_data(path, min));
+  ppc::reference::FileMax<double, uint64_t> maxTask(make_task_data(path, max));
+  ppc::reference::test::run_task(minTask);
+  ppc::reference::test::run_task(maxTask);
+  EXPECT_EQ(reinterpret_cast<double*>(min[0].data())[0], -5.0);
+  EXPECT_EQ(reinterpret_cast<uint64_t*>(min[1].data())[0], 123U);
+  EXPECT_EQ(reinterpret_cast<double*>(max[0].data())[0], 8.0);
+  EXPECT_EQ(reinterpret_cast<uint64_t*>(max[1].data())[0], 777U);
+  std::filesystem::remove(path);
+}
+
+TEST(file_reductions, check_sum_of_empty_file) {
+  // Create data
+  auto path = write_file("ppc_file_reductions_empty.bin", std::vector<int16_t>{});
+  std::vector<std::vector<uint8_t>> sum(1, std::vector<uint8_t>(sizeof(int16_t), 0xff));
+
+  // Create Task
+  ppc::reference::FileSum<int16_t> sumTask(make_task_data(path, sum));
+  ppc::reference::test::run_task(sumTask);
+  EXPECT_EQ(reinterpret_cast<int16_t*>(sum[0].data())[0], 0);
+  std::filesystem::remove(path);
+}
+
+TEST(file_reductions, check_validate_func) {
+  // Create data
+  auto path = write_file("ppc_file_reductions_odd.bin", std::vector<uint8_t>{1, 2, 3});
+  auto missing = (std::filesystem::temp_directory_path() / "ppc_file_reductions_missing.bin").string();
+  std::vector<std::vector<uint8_t>> out(2, std::vector<uint8_t>(sizeof(uint32_t)));
+
+  // Create Task
+  ppc::reference::FileMax<uint32_t, uint32_t> oddTask(make_task_data(path, out));
+  ppc::reference::FileMax<uint32_t, uint32_t> missingTask(make_task_data(missing, out));
+  EXPECT_EQ(oddTask.validation(), false);
+  EXPECT_EQ(missingTask.validation(), false);
+  std::filesystem::remove(path);
+}
+
+TEST(file_reductions, check_omp_matches_seq) { check_policy_matches_seq<ppc::reference::exec::omp>(); }
+
+TEST(file_reductions, check_tbb_matches_seq) { check_policy_matches_seq<ppc::reference::exec::tbb>(); }
+
+TEST(file_reductions, check_stl_matches_seq) { check_policy_matches_seq<ppc::reference::exec::stl>(); }
+
+TEST(file_reductions, check_mpi_matches_seq) { check_policy_matches_seq<ppc::reference::exec::mpi>(); }
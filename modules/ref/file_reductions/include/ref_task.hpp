@@ -0,0 +1,166 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_FILE_REDUCTIONS_REF_TASK_HPP_
+#define MODULES_REFERENCE_FILE_REDUCTIONS_REF_TASK_HPP_
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <system_error>
+
+#include "core/task/include/task.hpp"
+#include "ref/kernels/include/accumulator.hpp"
+#include "ref/kernels/include/mapped_file.hpp"
+#include "ref/kernels/include/parallel.hpp"
+#include "ref/kernels/include/reduce.hpp"
+
+namespace ppc {
+namespace reference {
+
+// Base of the tasks reducing a binary file of InType elements that may not fit
+// in memory: inputs[0] holds the characters of the file path and
+// inputs_count[0] their number. The file is memory mapped and streamed over
+// window by window, so the resident memory stays bounded.
+template <class InType>
+class FileTask : public ppc::core::Task {
+ public:
+  explicit FileTask(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(taskData_) {}
+
+  bool validation() override {
+    this->internal_order_test();
+    std::error_code error;
+    const auto size = std::filesystem::file_size(path(), error);
+    return !error && size % sizeof(InType) == 0 && (size > 0 || !non_empty) && outputs_valid();
+  }
+
+  bool pre_processing() override {
+    this->internal_order_test();
+    // Init input, the pages are read while the reduction streams over them
+    file = kernels::MappedFile(path());
+    return true;
+  }
+
+ protected:
+  std::string path() const {
+    return {reinterpret_cast<const char*>(taskData->inputs[0]), taskData->inputs_count[0]};
+  }
+  virtual bool outputs_valid() const { return taskData->outputs_count[0] == 1; }
+
+  // sum of the non-empty file accumulated in Acc
+  template <class Policy, class Acc = kernels::accumulator_t<InType>>
+  Acc stream_sum() const {
+    using W = kernels::detail::wrap_t<Acc>;
+    const InType* data = file.as<InType>();
+    return static_cast<Acc>(kernels::stream_reduce<Policy, InType>(
+        file,
+        [&](std::size_t begin, std::size_t end) {
+          return static_cast<W>(kernels::sum<InType, Acc>(data + begin, end - begin));
+        },
+        [](W lhs, W rhs) { return static_cast<W>(lhs + rhs); }));
+  }
+
+  kernels::MappedFile file;
+  // the reduction is undefined for an empty file
+  bool non_empty = true;
+};
+
+template <class InType, class OutType = InType, class Policy = exec::seq>
+class FileSum : public FileTask<InType> {
+ public:
+  explicit FileSum(std::shared_ptr<ppc::core::TaskData> taskData_) : FileTask<InType>(taskData_) {
+    this->non_empty = false;
+  }
+
+  bool run() override {
+    this->internal_order_test();
+    sum = this->file.size() == 0 ? OutType{0} : static_cast<OutType>(this->template stream_sum<Policy>());
+    return true;
+  }
+
+  bool post_processing() override {
+    this->internal_order_test();
+    reinterpret_cast<OutType*>(this->taskData->outputs[0])[0] = sum;
+    return true;
+  }
+
+ private:
+  OutType sum;
+};
+
+template <class InType, class OutType, class Policy = exec::seq>
+class FileAverage : public FileTask<InType> {
+ public:
+  explicit FileAverage(std::shared_ptr<ppc::core::TaskData> taskData_) : FileTask<InType>(taskData_) {}
+
+  bool run() override {
+    this->internal_order_test();
+    using Acc = kernels::average_accumulator_t<InType>;
+    average = static_cast<OutType>(this->template stream_sum<Policy, Acc>()) /
+              static_cast<OutType>(this->file.template count<InType>());
+    return true;
+  }
+
+  bool post_processing() override {
+    this->internal_order_test();
+    reinterpret_cast<OutType*>(this->taskData->outputs[0])[0] = average;
+    return true;
+  }
+
+ private:
+  OutType average;
+};
+
+// Writes the first smallest (IsMax = false) or largest element to outputs[0]
+// and its index in the file to outputs[1]
+template <bool IsMax, class InOutType, class IndexType, class Policy = exec::seq>
+class FileExtremum : public FileTask<InOutType> {
+ public:
+  explicit FileExtremum(std::shared_ptr<ppc::core::TaskData> taskData_) : FileTask<InOutType>(taskData_) {}
+
+  bool run() override {
+    this->internal_order_test();
+    const InOutType* data = this->file.template as<InOutType>();
+    // a NaN at the front is the answer, as in kernels::argmin
+    if (kernels::detail::is_nan(data[0])) {
+      best = {data[0], 0};
+      return true;
+    }
+    best = kernels::stream_reduce<Policy, InOutType>(
+        this->file,
+        [&](std::size_t begin, std::size_t end) {
+          auto window = kernels::detail::arg_extremum<IsMax>(data + begin, end - begin);
+          window.index += begin;
+          return window;
+        },
+        kernels::detail::better_of<IsMax, InOutType>);
+    return true;
+  }
+
+  bool post_processing() override {
+    this->internal_order_test();
+    reinterpret_cast<InOutType*>(this->taskData->outputs[0])[0] = best.value;
+    reinterpret_cast<IndexType*>(this->taskData->outputs[1])[0] = static_cast<IndexType>(best.index);
+    return true;
+  }
+
+ protected:
+  bool outputs_valid() const override {
+    return this->taskData->outputs_count[0] == 1 && this->taskData->outputs_count[1] == 1;
+  }
+
+ private:
+  kernels::Extremum<InOutType> best{};
+};
+
+template <class InOutType, class IndexType, class Policy = exec::seq>
+using FileMin = FileExtremum<false, InOutType, IndexType, Policy>;
+template <class InOutType, class IndexType, class Policy = exec::seq>
+using FileMax = FileExtremum<true, InOutType, IndexType, Policy>;
+
+}  // namespace reference
+}  // namespace ppc
+
+#endif  // MODULES_REFERENCE_FILE_REDUCTIONS_REF_TASK_HPP_
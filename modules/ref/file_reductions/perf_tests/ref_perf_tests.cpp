@@ -0,0 +1,91 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "ref/file_reductions/include/ref_task.hpp"
+#include "ref/kernels/func_tests/test_utils.hpp"
+#include "ref/kernels/perf_tests/perf_utils.hpp"
+
+namespace test = ppc::reference::test;
+namespace exec = ppc::reference::exec;
+
+namespace {
+
+// Writes count elements to a temporary file and measures Task over it; the
+// pipeline includes mapping the file
+template <class InType, class Policy, class Task>
+void measure(size_t count, size_t outputs_count, const std::string& task_name) {
+  // Create data
+  auto in = test::perf_input<InType>(count);
+  auto path = test::temp_path("ppc_file_reductions_perf.bin");
+  std::ofstream(path, std::ios::binary)
+      .write(reinterpret_cast<const char*>(in.data()), static_cast<std::streamsize>(in.size() * sizeof(InType)));
+  std::vector<std::vector<uint8_t>> outputs(outputs_count, std::vector<uint8_t>(sizeof(uint64_t)));
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(path.data()));
+  taskData->inputs_count.emplace_back(path.size());
+  for (auto& out : outputs) {
+    taskData->outputs.emplace_back(out.data());
+    taskData->outputs_count.emplace_back(1);
+  }
+
+  // Create Task
+  auto testTask = std::make_shared<Task>(taskData);
+  test::run_perf(testTask, test::case_name<InType, Policy>(count) + "_" + task_name);
+  testTask.reset();
+  std::filesystem::remove(path);
+}
+
+template <class InType, class OutType, class Policy = exec::seq>
+void measure_sum(size_t count) {
+  measure<InType, Policy, ppc::reference::FileSum<InType, OutType, Policy>>(count, 1, "sum");
+}
+
+template <class InType, class Policy = exec::seq>
+void measure_average(size_t count) {
+  measure<InType, Policy, ppc::reference::FileAverage<InType, double, Policy>>(count, 1, "average");
+}
+
+template <class InOutType, class IndexType, class Policy = exec::seq>
+void measure_min_max(size_t count) {
+  measure<InOutType, Policy, ppc::reference::FileMin<InOutType, IndexType, Policy>>(count, 2, "min");
+  measure<InOutType, Policy, ppc::reference::FileMax<InOutType, IndexType, Policy>>(count, 2, "max");
+}
+
+}  // namespace
+
+TEST(file_reductions_perf, test_int16_t) {
+  for (auto count : test::perf_sizes) measure_sum<int16_t, int16_t>(count);
+}
+
+TEST(file_reductions_perf, test_int32_t) {
+  for (auto count : test::perf_sizes) {
+    measure_sum<int32_t, int64_t>(count);
+    measure_average<int32_t>(count);
+    measure_min_max<int32_t, uint64_t>(count);
+  }
+}
+
+TEST(file_reductions_perf, test_uint32_t) {
+  for (auto count : test::perf_sizes) measure_min_max<uint32_t, uint32_t>(count);
+}
+
+TEST(file_reductions_perf, test_double) {
+  for (auto count : test::perf_sizes) measure_min_max<double, uint64_t>(count);
+}
+
+TEST(file_reductions_perf, test_omp) { measure_sum<int32_t, int64_t, exec::omp>(test::perf_backend_size); }
+
+TEST(file_reductions_perf, test_tbb) { measure_sum<int32_t, int64_t, exec::tbb>(test::perf_backend_size); }
+
+TEST(file_reductions_perf, test_stl) { measure_sum<int32_t, int64_t, exec::stl>(test::perf_backend_size); }
+
+TEST(file_reductions_perf, test_mpi) { measure_sum<int32_t, int64_t, exec::mpi>(test::perf_backend_size); }
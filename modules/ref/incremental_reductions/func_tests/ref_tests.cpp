@@ -0,0 +1,140 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "ref/incremental_reductions/include/ref_task.hpp"
+
+namespace {
+
+// TaskData appending batch and writing the result to the outputs
+std::shared_ptr<ppc::core::TaskData> make_task_data(auto& batch, std::vector<std::vector<uint8_t>>& outputs) {
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(batch.data()));
+  taskData->inputs_count.emplace_back(batch.size());
+  for (auto& out : outputs) {
+    taskData->outputs.emplace_back(out.data());
+    taskData->outputs_count.emplace_back(1);
+  }
+  return taskData;
+}
+
+void run(ppc::core::Task& task) {
+  ASSERT_EQ(task.validation(), true);
+  task.pre_processing();
+  task.run();
+  task.post_processing();
+}
+
+}  // namespace
+
+TEST(incremental_reductions, check_sum_int32_t) {
+  // Create data
+  std::vector<std::vector<int32_t>> batches = {{1, 2, 3}, {}, {10}, {-4, 100}};
+  std::vector<int64_t> expected = {6, 6, 16, 112};
+  std::vector<std::vector<uint8_t>> outputs(1, std::vector<uint8_t>(sizeof(int64_t)));
+
+  // Create Task
+  ppc::reference::IncrementalSum<int32_t, int64_t> testTask(make_task_data(batches[0], outputs));
+  for (size_t b = 0; b < batches.size(); b++) {
+    testTask.set_data(make_task_data(batches[b], outputs));
+    run(testTask);
+    ASSERT_EQ(reinterpret_cast<int64_t*>(outputs[0].data())[0], expected[b]);
+  }
+}
+
+TEST(incremental_reductions, check_sliding_sum_and_average) {
+  // Create data
+  std::vector<std::vector<int32_t>> batches = {{1, 2}, {3, 4, 5}, {6}, {7, 8, 9, 10, 11}};
+  // sum of the last three elements after each batch
+  std::vector<int32_t> expected = {3, 12, 15, 30};
+  std::vector<std::vector<uint8_t>> sums(1, std::vector<uint8_t>(sizeof(int32_t)));
+  std::vector<std::vector<uint8_t>> averages(1, std::vector<uint8_t>(sizeof(double)));
+
+  // Create Task
+  ppc::reference::IncrementalSum<int32_t> sumTask(make_task_data(batches[0], sums), 3);
+  ppc::reference::IncrementalAverage<int32_t, double> averageTask(make_task_data(batches[0], averages), 3);
+  for (size_t b = 0; b < batches.size(); b++) {
+    sumTask.set_data(make_task_data(batches[b], sums));
+    averageTask.set_data(make_task_data(batches[b], averages));
+    run(sumTask);
+    run(averageTask);
+    ASSERT_EQ(reinterpret_cast<int32_t*>(sums[0].data())[0], expected[b]);
+    ASSERT_DOUBLE_EQ(reinterpret_cast<double*>(averages[0].data())[0], expected[b] / (b == 0 ? 2.0 : 3.0));
+  }
+}
+
+TEST(incremental_reductions, check_average_int64_t_does_not_overflow) {
+  // Create data
+  std::vector<std::vector<int64_t>> batches = {{INT64_MAX}, {INT64_MAX}, {INT64_MAX, INT64_MAX}};
+  std::vector<std::vector<uint8_t>> averages(1, std::vector<uint8_t>(sizeof(double)));
+  std::vector<std::vector<uint8_t>> windowed(1, std::vector<uint8_t>(sizeof(double)));
+
+  // Create Task
+  ppc::reference::IncrementalAverage<int64_t, double> averageTask(make_task_data(batches[0], averages));
+  ppc::reference::IncrementalAverage<int64_t, double> windowTask(make_task_data(batches[0], windowed), 3);
+  for (auto& batch : batches) {
+    averageTask.set_data(make_task_data(batch, averages));
+    windowTask.set_data(make_task_data(batch, windowed));
+    run(averageTask);
+    run(windowTask);
+    ASSERT_DOUBLE_EQ(reinterpret_cast<double*>(averages[0].data())[0], static_cast<double>(INT64_MAX));
+    ASSERT_DOUBLE_EQ(reinterpret_cast<double*>(windowed[0].data())[0], static_cast<double>(INT64_MAX));
+  }
+}
+
+TEST(incremental_reductions, check_sliding_min_max) {
+  // Create data
+  std::vector<std::vector<double>> batches = {{5.0, 1.0}, {7.0, 1.0}, {3.0}, {9.0, 2.0, 2.0}};
+  // value and index in the series of the minimum of the last three elements
+  std::vector<double> min_values = {1.0, 1.0, 1.0, 2.0};
+  std::vector<uint64_t> min_indices = {1, 1, 3, 6};
+  std::vector<double> max_values = {5.0, 7.0, 7.0, 9.0};
+  std::vector<uint64_t> max_indices = {0, 2, 2, 5};
+  std::vector<std::vector<uint8_t>> min(2, std::vector<uint8_t>(sizeof(double)));
+  std::vector<std::vector<uint8_t>> max(2, std::vector<uint8_t>(sizeof(double)));
+
+  // Create Task
+  ppc::reference::IncrementalMin<double, uint64_t> minTask(make_task_data(batches[0], min), 3);
+  ppc::reference::IncrementalMax<double, uint64_t> maxTask(make_task_data(batches[0], max), 3);
+  for (size_t b = 0; b < batches.size(); b++) {
+    minTask.set_data(make_task_data(batches[b], min));
+    maxTask.set_data(make_task_data(batches[b], max));
+    run(minTask);
+    run(maxTask);
+    EXPECT_EQ(reinterpret_cast<double*>(min[0].data())[0], min_values[b]);
+    EXPECT_EQ(reinterpret_cast<uint64_t*>(min[1].data())[0], min_indices[b]);
+    EXPECT_EQ(reinterpret_cast<double*>(max[0].data())[0], max_values[b]);
+    EXPECT_EQ(reinterpret_cast<uint64_t*>(max[1].data())[0], max_indices[b]);
+  }
+}
+
+TEST(incremental_reductions, check_min_of_growing_series) {
+  // Create data
+  std::vector<std::vector<int8_t>> batches = {{4, 2, 9}, {2, 8}, {-1}, {-1, 5}};
+  std::vector<int8_t> values = {2, 2, -1, -1};
+  std::vector<uint32_t> indices = {1, 1, 5, 5};
+  std::vector<std::vector<uint8_t>> outputs(2, std::vector<uint8_t>(sizeof(uint32_t)));
+
+  // Create Task
+  ppc::reference::IncrementalMin<int8_t, uint32_t> testTask(make_task_data(batches[0], outputs));
+  for (size_t b = 0; b < batches.size(); b++) {
+    testTask.set_data(make_task_data(batches[b], outputs));
+    run(testTask);
+    EXPECT_EQ(reinterpret_cast<int8_t*>(outputs[0].data())[0], values[b]);
+    EXPECT_EQ(reinterpret_cast<uint32_t*>(outputs[1].data())[0], indices[b]);
+  }
+}
+
+TEST(incremental_reductions, check_validate_func) {
+  // Create data
+  std::vector<int32_t> empty;
+  std::vector<std::vector<uint8_t>> outputs(2, std::vector<uint8_t>(sizeof(int32_t)));
+
+  // Create Task
+  ppc::reference::IncrementalMax<int32_t, uint32_t> testTask(make_task_data(empty, outputs));
+  ASSERT_EQ(testTask.validation(), false);
+}
@@ -0,0 +1,141 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_INCREMENTAL_REDUCTIONS_REF_TASK_HPP_
+#define MODULES_REFERENCE_INCREMENTAL_REDUCTIONS_REF_TASK_HPP_
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+
+#include "core/task/include/task.hpp"
+#include "ref/kernels/include/accumulator.hpp"
+#include "ref/kernels/include/incremental.hpp"
+
+namespace ppc {
+namespace reference {
+
+// The incremental tasks keep their state between runs: every run appends the
+// elements of inputs[0] to the series (set_data passes the next batch) and
+// writes the reduction of the whole series, or of its last window elements
+// when the task is created with a window, in time proportional to the batch.
+
+template <class InType, class OutType = InType>
+class IncrementalSum : public ppc::core::Task {
+ public:
+  explicit IncrementalSum(std::shared_ptr<ppc::core::TaskData> taskData_, std::size_t window = 0)
+      : Task(taskData_), state(window) {}
+  bool pre_processing() override {
+    internal_order_test();
+    // Init input, the kernels read it in place
+    input_ = reinterpret_cast<InType*>(taskData->inputs[0]);
+    return true;
+  }
+
+  bool validation() override {
+    internal_order_test();
+    // Check count elements of output
+    return taskData->outputs_count[0] == 1;
+  }
+
+  bool run() override {
+    internal_order_test();
+    state.append(input_, taskData->inputs_count[0]);
+    return true;
+  }
+
+  bool post_processing() override {
+    internal_order_test();
+    reinterpret_cast<OutType*>(taskData->outputs[0])[0] = static_cast<OutType>(state.value());
+    return true;
+  }
+
+ private:
+  const InType* input_{};
+  kernels::RunningSum<InType> state;
+};
+
+template <class InType, class OutType>
+class IncrementalAverage : public ppc::core::Task {
+ public:
+  explicit IncrementalAverage(std::shared_ptr<ppc::core::TaskData> taskData_, std::size_t window = 0)
+      : Task(taskData_), state(window) {}
+  bool pre_processing() override {
+    internal_order_test();
+    // Init input, the kernels read it in place
+    input_ = reinterpret_cast<InType*>(taskData->inputs[0]);
+    return true;
+  }
+
+  bool validation() override {
+    internal_order_test();
+    // Check count elements of output, the series must not stay empty
+    return taskData->outputs_count[0] == 1 && state.seen() + taskData->inputs_count[0] > 0;
+  }
+
+  bool run() override {
+    internal_order_test();
+    state.append(input_, taskData->inputs_count[0]);
+    return true;
+  }
+
+  bool post_processing() override {
+    internal_order_test();
+    reinterpret_cast<OutType*>(taskData->outputs[0])[0] =
+        static_cast<OutType>(state.value()) / static_cast<OutType>(state.count());
+    return true;
+  }
+
+ private:
+  const InType* input_{};
+  kernels::RunningSum<InType, kernels::average_accumulator_t<InType>> state;
+};
+
+// Writes the value to outputs[0] and its index in the whole series to outputs[1]
+template <bool IsMax, class InOutType, class IndexType>
+class IncrementalExtremum : public ppc::core::Task {
+ public:
+  explicit IncrementalExtremum(std::shared_ptr<ppc::core::TaskData> taskData_, std::size_t window = 0)
+      : Task(taskData_), state(window) {}
+  bool pre_processing() override {
+    internal_order_test();
+    // Init input, the kernels read it in place
+    input_ = reinterpret_cast<InOutType*>(taskData->inputs[0]);
+    return true;
+  }
+
+  bool validation() override {
+    internal_order_test();
+    // Check count elements of output, the series must not stay empty
+    return taskData->outputs_count[0] == 1 && taskData->outputs_count[1] == 1 &&
+           state.seen() + taskData->inputs_count[0] > 0;
+  }
+
+  bool run() override {
+    internal_order_test();
+    state.append(input_, taskData->inputs_count[0]);
+    return true;
+  }
+
+  bool post_processing() override {
+    internal_order_test();
+    auto best = state.value();
+    reinterpret_cast<InOutType*>(taskData->outputs[0])[0] = best.value;
+    reinterpret_cast<IndexType*>(taskData->outputs[1])[0] = static_cast<IndexType>(best.index);
+    return true;
+  }
+
+ private:
+  const InOutType* input_{};
+  kernels::RunningExtremum<InOutType, IsMax> state;
+};
+
+template <class InOutType, class IndexType>
+using IncrementalMin = IncrementalExtremum<false, InOutType, IndexType>;
+template <class InOutType, class IndexType>
+using IncrementalMax = IncrementalExtremum<true, InOutType, IndexType>;
+
+}  // namespace reference
+}  // namespace ppc
+
+#endif  // MODULES_REFERENCE_INCREMENTAL_REDUCTIONS_REF_TASK_HPP_
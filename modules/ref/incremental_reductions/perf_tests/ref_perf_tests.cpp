@@ -0,0 +1,70 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "ref/incremental_reductions/include/ref_task.hpp"
+#include "ref/kernels/perf_tests/perf_utils.hpp"
+
+namespace test = ppc::reference::test;
+namespace exec = ppc::reference::exec;
+
+namespace {
+
+// Every run appends a batch of count elements, so the time per run is the
+// cost of one update; window 0 keeps the whole series
+template <class InType, class Task>
+void measure(size_t count, size_t window, size_t outputs_count, const std::string& task_name) {
+  // Create data
+  auto batch = test::perf_input<InType>(count);
+  std::vector<std::vector<uint8_t>> outputs(outputs_count, std::vector<uint8_t>(sizeof(uint64_t)));
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(batch.data()));
+  taskData->inputs_count.emplace_back(batch.size());
+  for (auto& out : outputs) {
+    taskData->outputs.emplace_back(out.data());
+    taskData->outputs_count.emplace_back(1);
+  }
+
+  // Create Task
+  auto testTask = std::make_shared<Task>(taskData, window);
+  const std::string window_name = window == 0 ? "" : "_window_" + std::to_string(window);
+  test::run_perf(testTask, test::case_name<InType, exec::seq>(count) + "_" + task_name + window_name);
+}
+
+// the whole series and a window about as long as the smallest batch
+const std::vector<size_t> windows = {0, 1000};
+
+}  // namespace
+
+TEST(incremental_reductions_perf, test_int32_t) {
+  for (auto count : test::perf_sizes) {
+    for (auto window : windows) {
+      measure<int32_t, ppc::reference::IncrementalSum<int32_t, int64_t>>(count, window, 1, "sum");
+      measure<int32_t, ppc::reference::IncrementalAverage<int32_t, double>>(count, window, 1, "average");
+      measure<int32_t, ppc::reference::IncrementalMax<int32_t, uint64_t>>(count, window, 2, "max");
+    }
+  }
+}
+
+TEST(incremental_reductions_perf, test_int8_t) {
+  for (auto count : test::perf_sizes) {
+    for (auto window : windows) {
+      measure<int8_t, ppc::reference::IncrementalMin<int8_t, uint64_t>>(count, window, 2, "min");
+    }
+  }
+}
+
+TEST(incremental_reductions_perf, test_double) {
+  for (auto count : test::perf_sizes) {
+    for (auto window : windows) {
+      measure<double, ppc::reference::IncrementalMin<double, uint64_t>>(count, window, 2, "min");
+      measure<double, ppc::reference::IncrementalMax<double, uint64_t>>(count, window, 2, "max");
+    }
+  }
+}
@@ -0,0 +1,110 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "ref/kernels/func_tests/test_utils.hpp"
+#include "ref/kernels/include/count.hpp"
+#include "ref/kernels/include/isa.hpp"
+#include "ref/kernels/include/parallel.hpp"
+
+namespace {
+
+using ppc::reference::kernels::Isa;
+using ppc::reference::test::available_isas;
+using ppc::reference::test::random_vector;
+using ppc::reference::test::sizes;
+
+template <class T>
+size_t expected_descents(const std::vector<T>& vec) {
+  size_t count = 0;
+  for (size_t i = 0; i + 1 < vec.size(); i++) {
+    if (vec[i] > vec[i + 1]) count++;
+  }
+  return count;
+}
+
+template <class T>
+size_t expected_sign_changes(const std::vector<T>& vec) {
+  size_t count = 0;
+  for (size_t i = 0; i + 1 < vec.size(); i++) {
+    if (static_cast<long double>(vec[i]) * static_cast<long double>(vec[i + 1]) < 0) count++;
+  }
+  return count;
+}
+
+template <class T>
+void check_count() {
+  const int64_t lo = std::is_signed_v<T> ? -3 : 0;
+  for (auto isa : available_isas()) {
+    ppc::reference::kernels::set_isa_limit(isa);
+    for (auto n : sizes) {
+      auto vec = random_vector<T>(n, lo, lo + 6, static_cast<unsigned>(n));
+      EXPECT_EQ(ppc::reference::kernels::count_descents(vec.data(), n), expected_descents(vec)) << "n = " << n;
+      EXPECT_EQ(ppc::reference::kernels::count_sign_changes(vec.data(), n), expected_sign_changes(vec)) << "n = " << n;
+    }
+    // longer than the block after which the 8-bit lane counters are flushed
+    std::vector<T> alternating(100000);
+    for (size_t i = 0; i < alternating.size(); i++) alternating[i] = static_cast<T>(i % 2 == 0 ? lo : lo + 5);
+    EXPECT_EQ(ppc::reference::kernels::count_descents(alternating.data(), alternating.size()),
+              expected_descents(alternating));
+    EXPECT_EQ(ppc::reference::kernels::count_sign_changes(alternating.data(), alternating.size()),
+              expected_sign_changes(alternating));
+  }
+  ppc::reference::kernels::set_isa_limit(Isa::AVX512);
+}
+
+template <class T, class Policy>
+void check_count_parallel() {
+  const size_t chunks = 4;
+  const size_t n = chunks * ppc::reference::exec::kMinChunk + 5;
+  ppc::reference::exec::set_concurrency(chunks);
+  std::vector<T> vec(n, 1);
+  // every chunk boundary lies inside a descending sign change
+  for (size_t c = 1; c < chunks; c++) {
+    vec[(n - 1) * c / chunks] = -1;
+  }
+  EXPECT_EQ(ppc::reference::kernels::count_descents<Policy>(vec.data(), n), chunks - 1);
+  EXPECT_EQ(ppc::reference::kernels::count_sign_changes<Policy>(vec.data(), n), 2 * (chunks - 1));
+
+  vec = random_vector<T>(n, -3, 3, 7);
+  EXPECT_EQ(ppc::reference::kernels::count_descents<Policy>(vec.data(), n), expected_descents(vec));
+  EXPECT_EQ(ppc::reference::kernels::count_sign_changes<Policy>(vec.data(), n), expected_sign_changes(vec));
+  ppc::reference::exec::set_concurrency(0);
+}
+
+}  // namespace
+
+TEST(count_kernels, check_int8_t) { check_count<int8_t>(); }
+
+TEST(count_kernels, check_uint8_t) { check_count<uint8_t>(); }
+
+TEST(count_kernels, check_int16_t) { check_count<int16_t>(); }
+
+TEST(count_kernels, check_int32_t) { check_count<int32_t>(); }
+
+TEST(count_kernels, check_uint32_t) { check_count<uint32_t>(); }
+
+TEST(count_kernels, check_int64_t) { check_count<int64_t>(); }
+
+TEST(count_kernels, check_float) { check_count<float>(); }
+
+TEST(count_kernels, check_double) { check_count<double>(); }
+
+TEST(count_kernels, check_sign_changes_do_not_overflow) {
+  const int32_t big = std::numeric_limits<int32_t>::max();
+  std::vector<int32_t> vec(100, big);
+  vec[50] = -big;
+  EXPECT_EQ(ppc::reference::kernels::count_sign_changes(vec.data(), vec.size()), 2U);
+  std::vector<double> tiny = {1e-200, -1e-200, 0.0, -0.0, -1.0};
+  EXPECT_EQ(ppc::reference::kernels::count_sign_changes(tiny.data(), tiny.size()), 1U);
+}
+
+TEST(count_kernels, check_parallel_omp) { check_count_parallel<int32_t, ppc::reference::exec::omp>(); }
+
+TEST(count_kernels, check_parallel_tbb) { check_count_parallel<double, ppc::reference::exec::tbb>(); }
+
+TEST(count_kernels, check_parallel_stl) { check_count_parallel<int8_t, ppc::reference::exec::stl>(); }
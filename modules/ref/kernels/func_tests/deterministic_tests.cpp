@@ -0,0 +1,127 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "ref/kernels/include/dot.hpp"
+#include "ref/kernels/include/matrix.hpp"
+#include "ref/kernels/include/parallel.hpp"
+#include "ref/kernels/include/reduce.hpp"
+
+namespace {
+
+using ppc::reference::exec::deterministic;
+using ppc::reference::kernels::Precision;
+
+// values of very different magnitudes, so that any change of the summation order shows up in the low bits
+template <class T>
+std::vector<T> mixed_magnitudes(size_t n, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+  std::uniform_int_distribution<int> exponent(-20, 20);
+  std::vector<T> vec(n);
+  for (auto& x : vec) x = static_cast<T>(std::ldexp(mantissa(gen), exponent(gen)));
+  return vec;
+}
+
+template <class T>
+bool same_bits(T lhs, T rhs) {
+  return std::memcmp(&lhs, &rhs, sizeof(T)) == 0;
+}
+
+template <class T>
+void check_reproducible() {
+  const size_t n = 10 * ppc::reference::exec::kMinChunk + 123;
+  auto x = mixed_magnitudes<T>(n, 1);
+  auto y = mixed_magnitudes<T>(n, 2);
+  auto matrix = ppc::reference::kernels::MatrixView<T>::row_major(x.data(), n / 7, 7);
+
+  ppc::reference::exec::set_concurrency(1);
+  const T sum = ppc::reference::kernels::parallel_sum<deterministic<ppc::reference::exec::seq>, T>(x.data(), n);
+  const T dot = ppc::reference::kernels::dot<Precision::FAST, deterministic<ppc::reference::exec::seq>>(x.data(),
+                                                                                                         y.data(), n);
+  const T dot_compensated =
+      ppc::reference::kernels::dot<Precision::COMPENSATED, deterministic<ppc::reference::exec::seq>>(x.data(),
+                                                                                                     y.data(), n);
+  const T total = ppc::reference::kernels::total_sum<deterministic<ppc::reference::exec::seq>>(matrix);
+
+  for (size_t workers : {1, 2, 3, 4, 7, 16}) {
+    ppc::reference::exec::set_concurrency(workers);
+    auto check = [&](auto policy) {
+      using Policy = deterministic<decltype(policy)>;
+      EXPECT_TRUE(same_bits(ppc::reference::kernels::parallel_sum<Policy, T>(x.data(), n), sum)) << workers;
+      EXPECT_TRUE(same_bits(ppc::reference::kernels::dot<Precision::FAST, Policy>(x.data(), y.data(), n), dot))
+          << workers;
+      EXPECT_TRUE(same_bits(ppc::reference::kernels::dot<Precision::COMPENSATED, Policy>(x.data(), y.data(), n),
+                            dot_compensated))
+          << workers;
+      EXPECT_TRUE(same_bits(ppc::reference::kernels::total_sum<Policy>(matrix), total)) << workers;
+    };
+    check(ppc::reference::exec::omp{});
+    check(ppc::reference::exec::tbb{});
+    check(ppc::reference::exec::stl{});
+  }
+  ppc::reference::exec::set_concurrency(0);
+}
+
+}  // namespace
+
+TEST(deterministic_kernels, check_float) { check_reproducible<float>(); }
+
+TEST(deterministic_kernels, check_double) { check_reproducible<double>(); }
+
+TEST(deterministic_kernels, check_tree_reduce) {
+  std::vector<int> partial = {1, 2, 3, 4, 5};
+  // ((1 2) (3 (4 5)))
+  auto shape = ppc::reference::exec::detail::tree_reduce(partial, 0, partial.size(),
+                                                         [](int lhs, int rhs) { return lhs * 10 + rhs; });
+  EXPECT_EQ(shape, ((1 * 10 + 2) * 10) + (3 * 10 + (4 * 10 + 5)));
+}
+
+TEST(deterministic_kernels, check_integer_sum) {
+  std::vector<int32_t> vec(5 * ppc::reference::exec::kMinChunk + 1, 3);
+  ppc::reference::exec::set_concurrency(3);
+  auto sum = ppc::reference::kernels::parallel_sum<deterministic<ppc::reference::exec::stl>, int32_t, int64_t>(
+      vec.data(), vec.size());
+  EXPECT_EQ(sum, 3 * static_cast<int64_t>(vec.size()));
+  ppc::reference::exec::set_concurrency(0);
+}
+
+TEST(deterministic_kernels, check_tall_col_sums) {
+  // short rows, so that the row blocks would be tiny without the block cap
+  const size_t rows = 200 * ppc::reference::exec::kMinChunk / 16;
+  auto x = mixed_magnitudes<double>(rows * 16, 3);
+  auto matrix = ppc::reference::kernels::MatrixView<double>::row_major(x.data(), rows, 16);
+  std::vector<double> expected(16);
+  ppc::reference::kernels::col_sums<deterministic<ppc::reference::exec::seq>>(matrix, expected.data());
+  for (size_t c = 0; c < 16; c++) {
+    double sum = 0;
+    for (size_t r = 0; r < rows; r++) sum += x[r * 16 + c];
+    EXPECT_NEAR(expected[c], sum, 1e-9 * (1 + std::abs(sum)));
+  }
+  for (size_t workers : {2, 3, 7}) {
+    ppc::reference::exec::set_concurrency(workers);
+    std::vector<double> out(16);
+    ppc::reference::kernels::col_sums<deterministic<ppc::reference::exec::stl>>(matrix, out.data());
+    for (size_t c = 0; c < 16; c++) EXPECT_TRUE(same_bits(out[c], expected[c])) << workers;
+  }
+  ppc::reference::exec::set_concurrency(0);
+}
+
+TEST(deterministic_kernels, check_empty_input) {
+  const std::vector<double> x;
+  auto check = [&](auto policy) {
+    using Policy = deterministic<decltype(policy)>;
+    EXPECT_EQ((ppc::reference::kernels::parallel_sum<Policy, double>(x.data(), 0)), 0.0);
+    EXPECT_EQ((ppc::reference::kernels::dot<Precision::FAST, Policy>(x.data(), x.data(), 0)), 0.0);
+    EXPECT_EQ((ppc::reference::kernels::dot<Precision::COMPENSATED, Policy>(x.data(), x.data(), 0)), 0.0);
+  };
+  check(ppc::reference::exec::seq{});
+  check(ppc::reference::exec::omp{});
+  check(ppc::reference::exec::tbb{});
+  check(ppc::reference::exec::stl{});
+}
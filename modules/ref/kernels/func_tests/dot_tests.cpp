@@ -0,0 +1,129 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "ref/kernels/func_tests/test_utils.hpp"
+#include "ref/kernels/include/dot.hpp"
+#include "ref/kernels/include/isa.hpp"
+#include "ref/kernels/include/parallel.hpp"
+
+namespace {
+
+using ppc::reference::kernels::Isa;
+using ppc::reference::kernels::Precision;
+using ppc::reference::test::available_isas;
+using ppc::reference::test::random_vector;
+using ppc::reference::test::sizes;
+
+template <class T>
+auto expected_dot(const std::vector<T>& x, const std::vector<T>& y) {
+  if constexpr (std::is_integral_v<T>) {
+    std::make_unsigned_t<T> acc = 0;
+    for (size_t i = 0; i < x.size(); i++) {
+      acc += static_cast<std::make_unsigned_t<T>>(x[i]) * static_cast<std::make_unsigned_t<T>>(y[i]);
+    }
+    return static_cast<T>(acc);
+  } else {
+    long double acc = 0;
+    for (size_t i = 0; i < x.size(); i++) acc += static_cast<long double>(x[i]) * y[i];
+    return acc;
+  }
+}
+
+template <Precision Mode, class T>
+void check_dot() {
+  for (auto isa : available_isas()) {
+    ppc::reference::kernels::set_isa_limit(isa);
+    for (auto n : sizes) {
+      auto x = random_vector<T>(n, std::is_signed_v<T> ? -100 : 0, 100, static_cast<unsigned>(n));
+      auto y = random_vector<T>(n, std::is_signed_v<T> ? -100 : 0, 100, static_cast<unsigned>(n + 1));
+      auto result = ppc::reference::kernels::dot<Mode>(x.data(), y.data(), n);
+      if constexpr (std::is_integral_v<T>) {
+        EXPECT_EQ(result, expected_dot(x, y)) << "n = " << n;
+      } else {
+        EXPECT_NEAR(result, expected_dot(x, y), 1e-4 * n * 100 * 100) << "n = " << n;
+      }
+    }
+  }
+  ppc::reference::kernels::set_isa_limit(Isa::AVX512);
+}
+
+// 1e8 swallows every following 1 in single precision and is cancelled at the end
+std::vector<float> ill_conditioned(size_t ones) {
+  std::vector<float> x(ones + 2, 1.f);
+  x.front() = 1e8f;
+  x.back() = -1e8f;
+  return x;
+}
+
+template <class Policy>
+void check_dot_parallel() {
+  const size_t n = 4 * ppc::reference::exec::kMinChunk + 7;
+  ppc::reference::exec::set_concurrency(4);
+  auto x = random_vector<int32_t>(n, -1000, 1000, 1);
+  auto y = random_vector<int32_t>(n, -1000, 1000, 2);
+  auto result = ppc::reference::kernels::dot<Precision::FAST, Policy>(x.data(), y.data(), n);
+  EXPECT_EQ(result, expected_dot(x, y));
+
+  auto xf = ill_conditioned(n);
+  std::vector<float> yf(xf.size(), 1.f);
+  auto result_f = ppc::reference::kernels::dot<Precision::COMPENSATED, Policy>(xf.data(), yf.data(), xf.size());
+  EXPECT_EQ(result_f, static_cast<float>(n));
+  ppc::reference::exec::set_concurrency(0);
+}
+
+}  // namespace
+
+TEST(dot_kernels, check_int8_t) { check_dot<Precision::FAST, int8_t>(); }
+
+TEST(dot_kernels, check_uint8_t) { check_dot<Precision::FAST, uint8_t>(); }
+
+TEST(dot_kernels, check_int16_t) { check_dot<Precision::FAST, int16_t>(); }
+
+TEST(dot_kernels, check_int32_t) { check_dot<Precision::FAST, int32_t>(); }
+
+TEST(dot_kernels, check_uint32_t) { check_dot<Precision::COMPENSATED, uint32_t>(); }
+
+TEST(dot_kernels, check_int64_t) { check_dot<Precision::PAIRWISE, int64_t>(); }
+
+TEST(dot_kernels, check_float_fast) { check_dot<Precision::FAST, float>(); }
+
+TEST(dot_kernels, check_float_pairwise) { check_dot<Precision::PAIRWISE, float>(); }
+
+TEST(dot_kernels, check_float_compensated) { check_dot<Precision::COMPENSATED, float>(); }
+
+TEST(dot_kernels, check_double_fast) { check_dot<Precision::FAST, double>(); }
+
+TEST(dot_kernels, check_double_compensated) { check_dot<Precision::COMPENSATED, double>(); }
+
+TEST(dot_kernels, check_compensated_is_exact) {
+  for (auto isa : available_isas()) {
+    ppc::reference::kernels::set_isa_limit(isa);
+    for (size_t ones : {1, 100, 1000, 5000}) {
+      auto x = ill_conditioned(ones);
+      std::vector<float> y(x.size(), 1.f);
+      EXPECT_EQ(ppc::reference::kernels::dot<Precision::COMPENSATED>(x.data(), y.data(), x.size()),
+                static_cast<float>(ones));
+    }
+  }
+  ppc::reference::kernels::set_isa_limit(Isa::AVX512);
+}
+
+TEST(dot_kernels, check_pairwise_error) {
+  const size_t n = 1 << 22;
+  std::vector<float> x(n, 0.1f);
+  std::vector<float> y(n, 1.f);
+  const double expected = static_cast<double>(n) * 0.1f;
+  EXPECT_NEAR(ppc::reference::kernels::dot<Precision::PAIRWISE>(x.data(), y.data(), n), expected, expected * 1e-6);
+  EXPECT_NEAR(ppc::reference::kernels::dot<Precision::COMPENSATED>(x.data(), y.data(), n), expected, expected * 1e-6);
+}
+
+TEST(dot_kernels, check_parallel_omp) { check_dot_parallel<ppc::reference::exec::omp>(); }
+
+TEST(dot_kernels, check_parallel_tbb) { check_dot_parallel<ppc::reference::exec::tbb>(); }
+
+TEST(dot_kernels, check_parallel_stl) { check_dot_parallel<ppc::reference::exec::stl>(); }
@@ -0,0 +1,120 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "ref/kernels/func_tests/test_utils.hpp"
+#include "ref/kernels/include/dot.hpp"
+#include "ref/kernels/include/half.hpp"
+#include "ref/kernels/include/isa.hpp"
+#include "ref/kernels/include/reduce.hpp"
+
+namespace {
+
+using ppc::reference::kernels::bfloat16;
+using ppc::reference::kernels::half;
+using ppc::reference::kernels::Isa;
+using ppc::reference::test::available_isas;
+using ppc::reference::test::random_vector;
+using ppc::reference::test::sizes;
+
+template <class H>
+H from_bits(uint32_t bits) {
+  H h;
+  h.bits = static_cast<uint16_t>(bits);
+  return h;
+}
+
+// Every bit pattern survives the round trip through float, NaNs stay NaNs
+template <class H>
+void check_round_trip() {
+  for (uint32_t bits = 0; bits < 65536; bits++) {
+    const float value = from_bits<H>(bits);
+    if (std::isnan(value)) {
+      EXPECT_TRUE(std::isnan(static_cast<float>(H(value)))) << bits;
+    } else {
+      EXPECT_EQ(H(value).bits, bits) << bits;
+    }
+  }
+}
+
+// The vector kernels widen every bit pattern the same way as the scalar
+// conversion: a block of 64 copies sums exactly in double
+template <class H>
+void check_widening() {
+  std::vector<H> block(64);
+  for (auto isa : available_isas()) {
+    ppc::reference::kernels::set_isa_limit(isa);
+    for (uint32_t bits = 0; bits < 65536; bits++) {
+      std::fill(block.begin(), block.end(), from_bits<H>(bits));
+      const double expected = 64.0 * static_cast<float>(block[0]);
+      const double result = ppc::reference::kernels::sum<H, double>(block.data(), block.size());
+      if (std::isnan(expected)) {
+        EXPECT_TRUE(std::isnan(result)) << bits;
+      } else {
+        EXPECT_EQ(result, expected) << bits;
+      }
+    }
+  }
+  ppc::reference::kernels::set_isa_limit(Isa::AVX512);
+}
+
+template <class H>
+void check_dot() {
+  for (auto isa : available_isas()) {
+    ppc::reference::kernels::set_isa_limit(isa);
+    for (auto n : sizes) {
+      auto x = random_vector<H>(n, -100, 100, static_cast<unsigned>(n));
+      auto y = random_vector<H>(n, -100, 100, static_cast<unsigned>(n + 1));
+      double expected = 0;
+      for (size_t i = 0; i < n; i++) expected += static_cast<double>(x[i]) * static_cast<float>(y[i]);
+      const float result = ppc::reference::kernels::dot(x.data(), y.data(), n);
+      EXPECT_NEAR(result, expected, 1e-4 * n * 100 * 100) << "n = " << n;
+    }
+  }
+  ppc::reference::kernels::set_isa_limit(Isa::AVX512);
+}
+
+}  // namespace
+
+TEST(kernels_half, half_round_trip) { check_round_trip<half>(); }
+
+TEST(kernels_half, bfloat16_round_trip) { check_round_trip<bfloat16>(); }
+
+TEST(kernels_half, half_rounds_to_nearest_even) {
+  EXPECT_EQ(half(1.0f).bits, 0x3c00);
+  // halfway between 1 and the next half rounds down to the even mantissa
+  EXPECT_EQ(half(1.0f + 0x1p-11f).bits, 0x3c00);
+  EXPECT_EQ(half(1.0f + 3 * 0x1p-11f).bits, 0x3c02);
+  EXPECT_EQ(half(65504.0f).bits, 0x7bff);
+  EXPECT_EQ(half(65520.0f).bits, 0x7c00);
+  EXPECT_EQ(half(-INFINITY).bits, 0xfc00);
+  EXPECT_EQ(half(0x1p-24f).bits, 0x0001);
+  EXPECT_EQ(half(0x1p-26f).bits, 0x0000);
+  EXPECT_EQ(half(-0.0f).bits, 0x8000);
+}
+
+TEST(kernels_half, bfloat16_rounds_to_nearest_even) {
+  EXPECT_EQ(bfloat16(1.0f).bits, 0x3f80);
+  EXPECT_EQ(bfloat16(1.0f + 0x1p-8f).bits, 0x3f80);
+  EXPECT_EQ(bfloat16(1.0f + 3 * 0x1p-8f).bits, 0x3f82);
+  EXPECT_EQ(bfloat16(INFINITY).bits, 0x7f80);
+  EXPECT_TRUE(std::isnan(static_cast<float>(bfloat16(NAN))));
+}
+
+TEST(kernels_half, half_widening_matches_scalar) { check_widening<half>(); }
+
+TEST(kernels_half, bfloat16_widening_matches_scalar) { check_widening<bfloat16>(); }
+
+TEST(kernels_half, half_sum_accumulates_in_float) {
+  // 4096 + 1 is not representable as a half, the float accumulator keeps it
+  std::vector<half> data(5000, half(1.0f));
+  EXPECT_EQ(ppc::reference::kernels::sum(data.data(), data.size()), 5000.0f);
+}
+
+TEST(kernels_half, half_dot) { check_dot<half>(); }
+
+TEST(kernels_half, bfloat16_dot) { check_dot<bfloat16>(); }
@@ -0,0 +1,85 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "ref/kernels/func_tests/test_utils.hpp"
+#include "ref/kernels/include/incremental.hpp"
+
+namespace {
+
+using ppc::reference::test::random_vector;
+
+// appends the series in batches of random length (empty ones included) and
+// checks the state against a recomputation from scratch after every batch
+template <class T, class Check>
+void append_in_batches(const std::vector<T>& series, std::size_t max_batch, const Check& check) {
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<std::size_t> batch(0, max_batch);
+  for (std::size_t begin = 0; begin < series.size();) {
+    const std::size_t end = std::min(series.size(), begin + batch(gen));
+    check(begin, end);
+    begin = end;
+  }
+}
+
+}  // namespace
+
+TEST(incremental_kernels, check_running_sum_int32_t) {
+  auto series = random_vector<int32_t>(5000, INT32_MIN, INT32_MAX, 1);
+  for (std::size_t window : {0, 1, 5, 64, 1000}) {
+    ppc::reference::kernels::RunningSum<int32_t> running(window);
+    append_in_batches(series, 300, [&](std::size_t begin, std::size_t end) {
+      running.append(series.data() + begin, end - begin);
+      const std::size_t first = window == 0 || end < window ? 0 : end - window;
+      int64_t expected = 0;
+      for (std::size_t i = first; i < end; i++) expected += series[i];
+      ASSERT_EQ(running.value(), expected) << "window " << window << ", end " << end;
+      ASSERT_EQ(running.count(), end - first);
+    });
+  }
+}
+
+TEST(incremental_kernels, check_running_sum_double) {
+  std::mt19937 gen(2);
+  std::uniform_real_distribution<double> dist(-1e6, 1e6);
+  std::vector<double> series(20000);
+  for (auto& x : series) x = dist(gen);
+  for (std::size_t window : {0, 3, 100, 4096}) {
+    ppc::reference::kernels::RunningSum<double> running(window);
+    append_in_batches(series, 50, [&](std::size_t begin, std::size_t end) {
+      running.append(series.data() + begin, end - begin);
+      const std::size_t first = window == 0 || end < window ? 0 : end - window;
+      double expected = 0;
+      for (std::size_t i = first; i < end; i++) expected += series[i];
+      ASSERT_NEAR(running.value(), expected, 1e-6) << "window " << window << ", end " << end;
+    });
+  }
+}
+
+TEST(incremental_kernels, check_running_min_max_ties) {
+  // few distinct values, so the first occurrence rule is exercised
+  auto series = random_vector<int16_t>(4000, -3, 3, 3);
+  for (std::size_t window : {0, 1, 2, 7, 250}) {
+    ppc::reference::kernels::RunningMin<int16_t> running_min(window);
+    ppc::reference::kernels::RunningMax<int16_t> running_max(window);
+    append_in_batches(series, 400, [&](std::size_t begin, std::size_t end) {
+      running_min.append(series.data() + begin, end - begin);
+      running_max.append(series.data() + begin, end - begin);
+      if (end == 0) return;
+      const auto first = series.begin() + static_cast<std::ptrdiff_t>(window == 0 || end < window ? 0 : end - window);
+      const auto last = series.begin() + static_cast<std::ptrdiff_t>(end);
+      auto min = running_min.value();
+      auto max = running_max.value();
+      ASSERT_EQ(min.index, static_cast<std::size_t>(std::min_element(first, last) - series.begin()))
+          << "window " << window << ", end " << end;
+      ASSERT_EQ(max.index, static_cast<std::size_t>(std::max_element(first, last) - series.begin()))
+          << "window " << window << ", end " << end;
+      ASSERT_EQ(min.value, series[min.index]);
+      ASSERT_EQ(max.value, series[max.index]);
+    });
+  }
+}
@@ -0,0 +1,78 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "ref/kernels/func_tests/test_utils.hpp"
+#include "ref/kernels/include/mapped_file.hpp"
+#include "ref/kernels/include/parallel.hpp"
+#include "ref/kernels/include/reduce.hpp"
+
+namespace {
+
+using ppc::reference::test::random_vector;
+using ppc::reference::test::temp_path;
+
+std::string write_file(const std::string& name, const void* data, std::size_t bytes) {
+  auto path = temp_path(name);
+  std::ofstream(path, std::ios::binary).write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+  return path;
+}
+
+template <class Policy>
+void check_stream_sum() {
+  ppc::reference::exec::set_concurrency(4);
+  // several windows of one block each plus a partial one
+  auto vec = random_vector<int32_t>(9 * ppc::reference::exec::kMinChunk + 77, INT32_MIN, INT32_MAX, 1);
+  auto path = write_file("ppc_mapped_file_stream.bin", vec.data(), vec.size() * sizeof(int32_t));
+  const int64_t expected = std::accumulate(vec.begin(), vec.end(), int64_t{0});
+  {
+    ppc::reference::kernels::MappedFile file(path);
+    ASSERT_EQ(file.count<int32_t>(), vec.size());
+    const int32_t* data = file.as<int32_t>();
+    auto chunk_sum = [&](std::size_t begin, std::size_t end) {
+      return ppc::reference::kernels::sum<int32_t, int64_t>(data + begin, end - begin);
+    };
+    auto add = [](int64_t lhs, int64_t rhs) { return lhs + rhs; };
+    for (std::size_t window : {std::size_t{1}, std::size_t{100000}, ppc::reference::kernels::kStreamWindow}) {
+      // the released pages of the previous round are read again
+      auto sum = ppc::reference::kernels::stream_reduce<Policy, int32_t>(file, chunk_sum, add, window);
+      EXPECT_EQ(sum, expected) << "window " << window;
+    }
+  }
+  std::filesystem::remove(path);
+  ppc::reference::exec::set_concurrency(0);
+}
+
+}  // namespace
+
+TEST(mapped_file, check_stream_sum_seq) { check_stream_sum<ppc::reference::exec::seq>(); }
+
+TEST(mapped_file, check_stream_sum_stl) { check_stream_sum<ppc::reference::exec::stl>(); }
+
+TEST(mapped_file, check_stream_sum_omp) { check_stream_sum<ppc::reference::exec::omp>(); }
+
+TEST(mapped_file, check_stream_sum_tbb) { check_stream_sum<ppc::reference::exec::tbb>(); }
+
+TEST(mapped_file, check_empty_file) {
+  auto path = write_file("ppc_mapped_file_empty.bin", nullptr, 0);
+  {
+    ppc::reference::kernels::MappedFile file(path);
+    EXPECT_EQ(file.size(), 0U);
+    EXPECT_EQ(file.data(), nullptr);
+    ppc::reference::kernels::MappedFile moved(std::move(file));
+    EXPECT_EQ(moved.size(), 0U);
+  }
+  std::filesystem::remove(path);
+}
+
+TEST(mapped_file, check_missing_file) {
+  auto path = temp_path("ppc_mapped_file_missing.bin");
+  EXPECT_THROW(ppc::reference::kernels::MappedFile{path}, std::system_error);
+}
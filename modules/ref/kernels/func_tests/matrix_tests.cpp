@@ -0,0 +1,90 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ref/kernels/func_tests/test_utils.hpp"
+#include "ref/kernels/include/isa.hpp"
+#include "ref/kernels/include/matrix.hpp"
+#include "ref/kernels/include/parallel.hpp"
+
+namespace {
+
+using ppc::reference::kernels::Isa;
+using ppc::reference::kernels::MatrixView;
+using ppc::reference::test::available_isas;
+using ppc::reference::test::random_vector;
+
+const std::vector<std::pair<size_t, size_t>> shapes = {{1, 1},  {1, 100}, {100, 1},  {37, 53},
+                                                        {3, 5000}, {5000, 3}, {300, 300}};
+
+// row-major, column-major and a strided view into a larger buffer
+template <class T>
+std::vector<MatrixView<T>> layouts(const std::vector<T>& buffer, size_t rows, size_t cols) {
+  return {MatrixView<T>::row_major(buffer.data(), rows, cols), MatrixView<T>::col_major(buffer.data(), rows, cols),
+          MatrixView<T>{buffer.data() + 1, rows, cols, 2 * cols + 3, 2}};
+}
+
+template <class Policy, class T>
+void check_matrix(size_t rows, size_t cols) {
+  // values are small integers, so floating point sums are exact in any order
+  auto buffer = random_vector<T>(rows * (2 * cols + 3) + 1, std::is_signed_v<T> ? -5 : 0, 5, 1);
+  for (const auto& m : layouts(buffer, rows, cols)) {
+    std::vector<T> expected_rows(rows, 0), expected_cols(cols, 0);
+    T expected_total = 0;
+    for (size_t r = 0; r < rows; r++) {
+      for (size_t c = 0; c < cols; c++) {
+        expected_rows[r] = static_cast<T>(expected_rows[r] + m.at(r, c));
+        expected_cols[c] = static_cast<T>(expected_cols[c] + m.at(r, c));
+        expected_total = static_cast<T>(expected_total + m.at(r, c));
+      }
+    }
+    std::vector<T> row_sums(rows), col_sums(cols);
+    ppc::reference::kernels::row_sums<Policy>(m, row_sums.data());
+    ppc::reference::kernels::col_sums<Policy>(m, col_sums.data());
+    EXPECT_EQ(row_sums, expected_rows) << rows << "x" << cols << " strides " << m.row_stride << ", " << m.col_stride;
+    EXPECT_EQ(col_sums, expected_cols) << rows << "x" << cols << " strides " << m.row_stride << ", " << m.col_stride;
+    EXPECT_EQ(ppc::reference::kernels::total_sum<Policy>(m), expected_total);
+  }
+}
+
+template <class T>
+void check_matrix_isas() {
+  for (auto isa : available_isas()) {
+    ppc::reference::kernels::set_isa_limit(isa);
+    for (auto [rows, cols] : shapes) check_matrix<ppc::reference::exec::seq, T>(rows, cols);
+  }
+  ppc::reference::kernels::set_isa_limit(Isa::AVX512);
+}
+
+template <class Policy>
+void check_matrix_parallel() {
+  ppc::reference::exec::set_concurrency(4);
+  check_matrix<Policy, int32_t>(40000, 4);
+  check_matrix<Policy, double>(4, 40000);
+  check_matrix<Policy, float>(513, 511);
+  ppc::reference::exec::set_concurrency(0);
+}
+
+}  // namespace
+
+TEST(matrix_kernels, check_int8_t) { check_matrix_isas<int8_t>(); }
+
+TEST(matrix_kernels, check_uint16_t) { check_matrix_isas<uint16_t>(); }
+
+TEST(matrix_kernels, check_int32_t) { check_matrix_isas<int32_t>(); }
+
+TEST(matrix_kernels, check_int64_t) { check_matrix_isas<int64_t>(); }
+
+TEST(matrix_kernels, check_float) { check_matrix_isas<float>(); }
+
+TEST(matrix_kernels, check_double) { check_matrix_isas<double>(); }
+
+TEST(matrix_kernels, check_parallel_omp) { check_matrix_parallel<ppc::reference::exec::omp>(); }
+
+TEST(matrix_kernels, check_parallel_tbb) { check_matrix_parallel<ppc::reference::exec::tbb>(); }
+
+TEST(matrix_kernels, check_parallel_stl) { check_matrix_parallel<ppc::reference::exec::stl>(); }
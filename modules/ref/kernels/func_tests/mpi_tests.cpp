@@ -0,0 +1,61 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "ref/kernels/func_tests/test_utils.hpp"
+#include "ref/kernels/include/parallel.hpp"
+#include "ref/kernels/include/reduce.hpp"
+
+#ifdef USE_MPI
+namespace {
+
+const auto* const mpi_environment = ::testing::AddGlobalTestEnvironment(new ppc::reference::test::MpiEnvironment);
+
+}  // namespace
+#endif
+
+namespace exec = ppc::reference::exec;
+
+namespace {
+
+struct ChunkSum {
+  int64_t sum;
+  uint64_t begin;
+};
+
+}  // namespace
+
+TEST(kernels_mpi, chunk_results_reach_every_rank_in_order) {
+  std::vector<int32_t> data(100000);
+  for (size_t i = 0; i < data.size(); i++) data[i] = static_cast<int32_t>(i % 1000) - 400;
+  for (std::size_t workers : {1, 3, 7}) {
+    exec::set_concurrency(workers);
+    std::vector<uint64_t> order;
+    auto result = exec::chunked_reduce<exec::mpi>(
+        data.size(), 1000,
+        [&](std::size_t begin, std::size_t end) {
+          return ChunkSum{ppc::reference::kernels::sum<int32_t, int64_t>(data.data() + begin, end - begin), begin};
+        },
+        [&](ChunkSum lhs, ChunkSum rhs) {
+          if (order.empty()) order.push_back(lhs.begin);
+          order.push_back(rhs.begin);
+          return ChunkSum{lhs.sum + rhs.sum, lhs.begin};
+        });
+    EXPECT_EQ(result.sum, 100 * (499500 - 400000));
+    EXPECT_EQ(order.size(), workers == 1 ? 0 : workers);
+    for (size_t c = 1; c < order.size(); c++) EXPECT_LT(order[c - 1], order[c]);
+  }
+  exec::set_concurrency(0);
+}
+
+TEST(kernels_mpi, deterministic_sum_matches_seq) {
+  std::vector<float> data(200000);
+  for (size_t i = 0; i < data.size(); i++) data[i] = 1.f / static_cast<float>(i % 997 + 1);
+  exec::set_concurrency(5);
+  const float mpi = ppc::reference::kernels::parallel_sum<exec::deterministic<exec::mpi>>(data.data(), data.size());
+  exec::set_concurrency(0);
+  const float seq = ppc::reference::kernels::parallel_sum<exec::deterministic<exec::seq>>(data.data(), data.size());
+  EXPECT_EQ(mpi, seq);
+}
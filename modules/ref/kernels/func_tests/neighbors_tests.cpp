@@ -0,0 +1,133 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "ref/kernels/func_tests/test_utils.hpp"
+#include "ref/kernels/include/isa.hpp"
+#include "ref/kernels/include/neighbors.hpp"
+#include "ref/kernels/include/parallel.hpp"
+
+namespace {
+
+using ppc::reference::kernels::Isa;
+using ppc::reference::test::available_isas;
+using ppc::reference::test::random_vector;
+using ppc::reference::test::sizes;
+
+template <bool IsMax, class T>
+size_t expected_pair(const std::vector<T>& vec) {
+  auto distance = [&](size_t i) {
+    if constexpr (std::is_integral_v<T>) {
+      return std::abs(static_cast<int64_t>(vec[i + 1]) - static_cast<int64_t>(vec[i]));
+    } else {
+      return std::abs(vec[i + 1] - vec[i]);
+    }
+  };
+  size_t best = 0;
+  for (size_t i = 1; i + 1 < vec.size(); i++) {
+    if (IsMax ? distance(best) < distance(i) : distance(i) < distance(best)) best = i;
+  }
+  return best;
+}
+
+template <class T>
+void check_neighbors() {
+  const int64_t lo = std::is_signed_v<T> ? -20 : 0;
+  for (auto isa : available_isas()) {
+    ppc::reference::kernels::set_isa_limit(isa);
+    for (auto n : sizes) {
+      if (n < 2) continue;
+      auto vec = random_vector<T>(n, lo, lo + 40, static_cast<unsigned>(n));
+      EXPECT_EQ(ppc::reference::kernels::nearest_neighbors(vec.data(), n), expected_pair<false>(vec)) << "n = " << n;
+      EXPECT_EQ(ppc::reference::kernels::most_different_neighbors(vec.data(), n), expected_pair<true>(vec))
+          << "n = " << n;
+    }
+  }
+  ppc::reference::kernels::set_isa_limit(Isa::AVX512);
+}
+
+template <class T, class Policy>
+void check_neighbors_parallel() {
+  const size_t chunks = 4;
+  const size_t n = chunks * ppc::reference::exec::kMinChunk + 3;
+  const int64_t lo = std::is_signed_v<T> ? -20 : 0;
+  ppc::reference::exec::set_concurrency(chunks);
+  for (size_t c = 1; c < chunks; c++) {
+    auto vec = random_vector<T>(n, lo, lo + 40, static_cast<unsigned>(c));
+    // the extreme pairs straddle a chunk boundary
+    const size_t boundary = (n - 1) * c / chunks;
+    vec[boundary - 1] = static_cast<T>(lo);
+    vec[boundary] = static_cast<T>(lo + 100);
+    vec[boundary + 1] = static_cast<T>(lo + 100);
+    EXPECT_EQ(ppc::reference::kernels::most_different_neighbors<Policy>(vec.data(), n), boundary - 1);
+    EXPECT_EQ(ppc::reference::kernels::nearest_neighbors<Policy>(vec.data(), n), expected_pair<false>(vec));
+    EXPECT_EQ(ppc::reference::kernels::nearest_neighbors<Policy>(vec.data(), n),
+              ppc::reference::kernels::nearest_neighbors(vec.data(), n));
+  }
+  ppc::reference::exec::set_concurrency(0);
+}
+
+// NaN distances at the chunk starts are skipped the same way for every
+// thread count, a NaN in the first pair wins
+template <class Policy>
+void check_neighbors_nan() {
+  const size_t n = 8 * ppc::reference::exec::kMinChunk + 5;
+  auto vec = random_vector<double>(n, -20, 20, 5U);
+  for (size_t i = 1; i < n; i += 61) vec[i] = std::numeric_limits<double>::quiet_NaN();
+  for (int leading = 0; leading < 2; leading++) {
+    for (auto isa : available_isas()) {
+      ppc::reference::kernels::set_isa_limit(isa);
+      for (size_t threads = 1; threads <= 8; threads++) {
+        ppc::reference::exec::set_concurrency(threads);
+        EXPECT_EQ(ppc::reference::kernels::nearest_neighbors<Policy>(vec.data(), n), expected_pair<false>(vec))
+            << "threads = " << threads;
+        EXPECT_EQ(ppc::reference::kernels::most_different_neighbors<Policy>(vec.data(), n), expected_pair<true>(vec))
+            << "threads = " << threads;
+      }
+    }
+    vec[0] = std::numeric_limits<double>::quiet_NaN();
+  }
+  ppc::reference::exec::set_concurrency(0);
+  ppc::reference::kernels::set_isa_limit(Isa::AVX512);
+}
+
+}  // namespace
+
+TEST(neighbors_kernels, check_int8_t) { check_neighbors<int8_t>(); }
+
+TEST(neighbors_kernels, check_uint8_t) { check_neighbors<uint8_t>(); }
+
+TEST(neighbors_kernels, check_int16_t) { check_neighbors<int16_t>(); }
+
+TEST(neighbors_kernels, check_int32_t) { check_neighbors<int32_t>(); }
+
+TEST(neighbors_kernels, check_uint32_t) { check_neighbors<uint32_t>(); }
+
+TEST(neighbors_kernels, check_int64_t) { check_neighbors<int64_t>(); }
+
+TEST(neighbors_kernels, check_float) { check_neighbors<float>(); }
+
+TEST(neighbors_kernels, check_double) { check_neighbors<double>(); }
+
+TEST(neighbors_kernels, check_no_overflow) {
+  std::vector<int8_t> vec8 = {0, -128, 127, 127, 0};
+  EXPECT_EQ(ppc::reference::kernels::most_different_neighbors(vec8.data(), vec8.size()), 1U);
+  std::vector<int64_t> vec64 = {0, 1, std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min()};
+  EXPECT_EQ(ppc::reference::kernels::most_different_neighbors(vec64.data(), vec64.size()), 2U);
+  EXPECT_EQ(ppc::reference::kernels::nearest_neighbors(vec64.data(), vec64.size()), 0U);
+}
+
+TEST(neighbors_kernels, check_parallel_omp) { check_neighbors_parallel<int32_t, ppc::reference::exec::omp>(); }
+
+TEST(neighbors_kernels, check_parallel_tbb) { check_neighbors_parallel<double, ppc::reference::exec::tbb>(); }
+
+TEST(neighbors_kernels, check_parallel_stl) { check_neighbors_parallel<int8_t, ppc::reference::exec::stl>(); }
+
+TEST(neighbors_kernels, check_nan_omp) { check_neighbors_nan<ppc::reference::exec::omp>(); }
+
+TEST(neighbors_kernels, check_nan_stl) { check_neighbors_nan<ppc::reference::exec::stl>(); }
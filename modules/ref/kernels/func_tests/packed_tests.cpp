@@ -0,0 +1,121 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "ref/kernels/func_tests/test_utils.hpp"
+#include "ref/kernels/include/count.hpp"
+#include "ref/kernels/include/isa.hpp"
+#include "ref/kernels/include/packed.hpp"
+#include "ref/kernels/include/parallel.hpp"
+
+namespace {
+
+using ppc::reference::kernels::Encoding;
+using ppc::reference::test::available_isas;
+using ppc::reference::test::random_vector;
+
+// random walk with steps in [-step, step], what the delta encoding is made for
+template <class T>
+std::vector<T> random_walk(std::size_t n, int64_t step, unsigned seed) {
+  auto steps = random_vector<int64_t>(n, -step, step, seed);
+  std::vector<T> vec(n);
+  int64_t x = 0;
+  for (std::size_t i = 0; i < n; i++) {
+    x += steps[i];
+    vec[i] = static_cast<T>(x);
+  }
+  return vec;
+}
+
+template <class T>
+void check_round_trip(const std::vector<T>& vec) {
+  for (auto encoding : {Encoding::FOR, Encoding::DELTA}) {
+    auto buffer = ppc::reference::kernels::pack(vec.data(), vec.size(), encoding);
+    ppc::reference::kernels::PackedView<T> packed(buffer.data(), buffer.size());
+    ASSERT_TRUE(packed.valid());
+    for (auto isa : available_isas()) {
+      ppc::reference::kernels::set_isa_limit(isa);
+      ASSERT_EQ(ppc::reference::kernels::unpack(packed), vec)
+          << "isa " << static_cast<int>(isa) << ", encoding " << static_cast<int>(encoding) << ", n " << vec.size();
+    }
+    ppc::reference::kernels::set_isa_limit(ppc::reference::kernels::Isa::AVX512);
+  }
+}
+
+template <class T>
+void check_round_trips() {
+  for (std::size_t n : {1, 2, 17, 511, 512, 513, 5000}) {
+    check_round_trip(random_vector<T>(n, 0, 0, 1));
+    check_round_trip(random_vector<T>(n, -3, 100, 2));
+    check_round_trip(random_walk<T>(n, 5, 3));
+    check_round_trip(
+        random_vector<T>(n, std::numeric_limits<T>::min(), static_cast<int64_t>(std::numeric_limits<T>::max()), 4));
+  }
+}
+
+template <class Policy>
+void check_reductions() {
+  ppc::reference::exec::set_concurrency(4);
+  const std::size_t n = 5 * ppc::reference::exec::kMinChunk + 300;
+  for (const auto& vec : {random_vector<int32_t>(n, -200, 1000, 5), random_walk<int32_t>(n, 3, 6)}) {
+    for (auto encoding : {Encoding::FOR, Encoding::DELTA}) {
+      auto buffer = ppc::reference::kernels::pack(vec.data(), vec.size(), encoding);
+      ppc::reference::kernels::PackedView<int32_t> packed(buffer.data(), buffer.size());
+      auto sum = ppc::reference::kernels::packed_sum<Policy>(packed);
+      EXPECT_EQ(sum, std::accumulate(vec.begin(), vec.end(), int64_t{0}));
+      EXPECT_EQ(ppc::reference::kernels::packed_min_index<Policy>(packed),
+                static_cast<std::size_t>(std::min_element(vec.begin(), vec.end()) - vec.begin()));
+      EXPECT_EQ(ppc::reference::kernels::packed_max_index<Policy>(packed),
+                static_cast<std::size_t>(std::max_element(vec.begin(), vec.end()) - vec.begin()));
+      EXPECT_EQ(ppc::reference::kernels::packed_count_descents<Policy>(packed),
+                ppc::reference::kernels::count_descents(vec.data(), vec.size()));
+      EXPECT_EQ(ppc::reference::kernels::packed_count_sign_changes<Policy>(packed),
+                ppc::reference::kernels::count_sign_changes(vec.data(), vec.size()));
+    }
+  }
+  ppc::reference::exec::set_concurrency(0);
+}
+
+}  // namespace
+
+TEST(packed_kernels, check_round_trip_int8_t) { check_round_trips<int8_t>(); }
+
+TEST(packed_kernels, check_round_trip_uint16_t) { check_round_trips<uint16_t>(); }
+
+TEST(packed_kernels, check_round_trip_int32_t) { check_round_trips<int32_t>(); }
+
+TEST(packed_kernels, check_round_trip_uint32_t) { check_round_trips<uint32_t>(); }
+
+TEST(packed_kernels, check_round_trip_int64_t) { check_round_trips<int64_t>(); }
+
+TEST(packed_kernels, check_compression) {
+  auto vec = random_walk<int32_t>(100000, 7, 7);
+  auto delta = ppc::reference::kernels::pack(vec.data(), vec.size(), Encoding::DELTA);
+  auto small = random_vector<int32_t>(100000, 0, 15, 8);
+  auto frame = ppc::reference::kernels::pack(small.data(), small.size(), Encoding::FOR);
+  // steps of at most 7 take a few bits, values below 16 take 4 bits
+  EXPECT_LT(delta.size(), vec.size() * sizeof(int32_t) / 3);
+  EXPECT_LT(frame.size(), small.size() * sizeof(int32_t) / 6);
+}
+
+TEST(packed_kernels, check_invalid_buffers) {
+  auto vec = random_vector<int16_t>(3000, -5, 5, 9);
+  auto buffer = ppc::reference::kernels::pack(vec.data(), vec.size(), Encoding::FOR);
+  EXPECT_TRUE(ppc::reference::kernels::PackedView<int16_t>(buffer.data(), buffer.size()).valid());
+  EXPECT_FALSE(ppc::reference::kernels::PackedView<int16_t>(buffer.data(), buffer.size() - 1).valid());
+  EXPECT_FALSE(ppc::reference::kernels::PackedView<int32_t>(buffer.data(), buffer.size()).valid());
+  EXPECT_FALSE(ppc::reference::kernels::PackedView<int16_t>(buffer.data(), 5).valid());
+}
+
+TEST(packed_kernels, check_reductions_seq) { check_reductions<ppc::reference::exec::seq>(); }
+
+TEST(packed_kernels, check_reductions_stl) { check_reductions<ppc::reference::exec::stl>(); }
+
+TEST(packed_kernels, check_reductions_omp) { check_reductions<ppc::reference::exec::omp>(); }
+
+TEST(packed_kernels, check_reductions_tbb) { check_reductions<ppc::reference::exec::tbb>(); }
@@ -0,0 +1,213 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "ref/kernels/func_tests/test_utils.hpp"
+#include "ref/kernels/include/accumulator.hpp"
+#include "ref/kernels/include/isa.hpp"
+#include "ref/kernels/include/parallel.hpp"
+#include "ref/kernels/include/reduce.hpp"
+
+namespace {
+
+using ppc::reference::kernels::Isa;
+using ppc::reference::test::available_isas;
+using ppc::reference::test::random_vector;
+using ppc::reference::test::sizes;
+
+template <class T>
+void check_sum() {
+  using W = ppc::reference::kernels::detail::wrap_t<T>;
+  const int64_t lo = std::is_signed_v<T> ? -100 : 0;
+  for (auto isa : available_isas()) {
+    ppc::reference::kernels::set_isa_limit(isa);
+    for (auto n : sizes) {
+      auto vec = random_vector<T>(n, lo, 100, static_cast<unsigned>(n));
+      if constexpr (std::is_integral_v<T>) {
+        // full range values overflow the accumulator, the result must still wrap like the scalar loop
+        std::mt19937_64 gen(n);
+        for (auto& x : vec) x = static_cast<T>(gen());
+        W expected = 0;
+        for (auto x : vec) expected += static_cast<W>(x);
+        EXPECT_EQ(ppc::reference::kernels::sum(vec.data(), vec.size()), static_cast<T>(expected)) << "n = " << n;
+      } else {
+        auto expected = std::accumulate(vec.begin(), vec.end(), 0.0);
+        EXPECT_NEAR(ppc::reference::kernels::sum(vec.data(), vec.size()), expected, 1e-3) << "n = " << n;
+      }
+      auto expected_double = std::accumulate(vec.begin(), vec.end(), 0.0);
+      EXPECT_NEAR((ppc::reference::kernels::sum<T, double>(vec.data(), vec.size())), expected_double,
+                  std::abs(expected_double) * 1e-12 + 1e-3)
+          << "n = " << n;
+    }
+  }
+  ppc::reference::kernels::set_isa_limit(Isa::AVX512);
+}
+
+template <class T>
+void check_widening_sum() {
+  using Acc = ppc::reference::kernels::accumulator_t<T>;
+  for (auto isa : available_isas()) {
+    ppc::reference::kernels::set_isa_limit(isa);
+    for (auto n : sizes) {
+      auto vec = random_vector<T>(n, std::numeric_limits<T>::min(), std::numeric_limits<T>::max(), 3);
+      Acc expected = 0;
+      for (auto x : vec) expected += x;
+      EXPECT_EQ((ppc::reference::kernels::sum<T, Acc>(vec.data(), n)), expected) << "n = " << n;
+    }
+    for (auto value : {std::numeric_limits<T>::min(), std::numeric_limits<T>::max()}) {
+      std::vector<T> vec(100003, value);
+      EXPECT_EQ((ppc::reference::kernels::sum<T, Acc>(vec.data(), vec.size())), static_cast<Acc>(value) * 100003);
+    }
+  }
+  ppc::reference::kernels::set_isa_limit(Isa::AVX512);
+}
+
+template <class T>
+void check_min_max() {
+  const int64_t lo = std::is_signed_v<T> ? -5 : 0;
+  for (auto isa : available_isas()) {
+    ppc::reference::kernels::set_isa_limit(isa);
+    for (auto n : sizes) {
+      // few distinct values, so the first of several equal extremes has to be found
+      auto vec = random_vector<T>(n, lo, lo + 10, static_cast<unsigned>(n) + 7U);
+      for (int extremes = 0; extremes < 2; extremes++) {
+        auto min_expected = std::min_element(vec.begin(), vec.end()) - vec.begin();
+        auto max_expected = std::max_element(vec.begin(), vec.end()) - vec.begin();
+        EXPECT_EQ(ppc::reference::kernels::min_index(vec.data(), vec.size()), static_cast<size_t>(min_expected));
+        EXPECT_EQ(ppc::reference::kernels::max_index(vec.data(), vec.size()), static_cast<size_t>(max_expected));
+        // then with the extreme values of the type at both ends
+        vec.back() = std::numeric_limits<T>::lowest();
+        vec.front() = std::numeric_limits<T>::max();
+      }
+    }
+  }
+  ppc::reference::kernels::set_isa_limit(Isa::AVX512);
+}
+
+// argmin and argmax give the std::min_element / std::max_element answer for
+// every thread count: ties and NaNs land on both sides of the chunk boundaries
+template <class T, class Policy>
+void check_arg_extremum_parallel() {
+  const size_t n = 8 * ppc::reference::exec::kMinChunk + 5;
+  const int64_t lo = std::is_signed_v<T> ? -5 : 0;
+  auto vec = random_vector<T>(n, lo, lo + 10, 11U);
+  if constexpr (std::is_floating_point_v<T>) {
+    for (size_t i = 1; i < n; i += 97) vec[i] = std::numeric_limits<T>::quiet_NaN();
+  }
+  const auto min_expected = static_cast<size_t>(std::min_element(vec.begin(), vec.end()) - vec.begin());
+  const auto max_expected = static_cast<size_t>(std::max_element(vec.begin(), vec.end()) - vec.begin());
+  for (auto isa : available_isas()) {
+    ppc::reference::kernels::set_isa_limit(isa);
+    for (size_t threads = 1; threads <= 8; threads++) {
+      ppc::reference::exec::set_concurrency(threads);
+      auto min = ppc::reference::kernels::argmin<Policy>(vec.data(), n);
+      auto max = ppc::reference::kernels::argmax<Policy>(vec.data(), n);
+      EXPECT_EQ(min.index, min_expected) << "threads = " << threads;
+      EXPECT_EQ(max.index, max_expected) << "threads = " << threads;
+      EXPECT_EQ(min.value, vec[min_expected]);
+      EXPECT_EQ(max.value, vec[max_expected]);
+    }
+  }
+  ppc::reference::exec::set_concurrency(0);
+  ppc::reference::kernels::set_isa_limit(Isa::AVX512);
+}
+
+}  // namespace
+
+TEST(reduce_kernels, check_sum_int8_t) { check_sum<int8_t>(); }
+
+TEST(reduce_kernels, check_sum_uint8_t) { check_sum<uint8_t>(); }
+
+TEST(reduce_kernels, check_sum_int16_t) { check_sum<int16_t>(); }
+
+TEST(reduce_kernels, check_sum_uint16_t) { check_sum<uint16_t>(); }
+
+TEST(reduce_kernels, check_sum_int32_t) { check_sum<int32_t>(); }
+
+TEST(reduce_kernels, check_sum_uint32_t) { check_sum<uint32_t>(); }
+
+TEST(reduce_kernels, check_sum_int64_t) { check_sum<int64_t>(); }
+
+TEST(reduce_kernels, check_sum_uint64_t) { check_sum<uint64_t>(); }
+
+TEST(reduce_kernels, check_sum_float) { check_sum<float>(); }
+
+TEST(reduce_kernels, check_sum_double) { check_sum<double>(); }
+
+TEST(reduce_kernels, check_accumulator_types) {
+  using ppc::reference::kernels::accumulator_t;
+  static_assert(std::is_same_v<accumulator_t<int8_t>, int64_t>);
+  static_assert(std::is_same_v<accumulator_t<uint8_t>, uint64_t>);
+  static_assert(std::is_same_v<accumulator_t<int32_t>, int64_t>);
+  static_assert(std::is_same_v<accumulator_t<uint64_t>, uint64_t>);
+  static_assert(std::is_same_v<accumulator_t<float>, double>);
+  static_assert(std::is_same_v<accumulator_t<double>, double>);
+}
+
+TEST(reduce_kernels, check_widening_sum_int8_t) { check_widening_sum<int8_t>(); }
+
+TEST(reduce_kernels, check_widening_sum_uint8_t) { check_widening_sum<uint8_t>(); }
+
+TEST(reduce_kernels, check_widening_sum_int16_t) { check_widening_sum<int16_t>(); }
+
+TEST(reduce_kernels, check_widening_sum_uint32_t) { check_widening_sum<uint32_t>(); }
+
+TEST(reduce_kernels, check_min_max_int8_t) { check_min_max<int8_t>(); }
+
+TEST(reduce_kernels, check_min_max_uint8_t) { check_min_max<uint8_t>(); }
+
+TEST(reduce_kernels, check_min_max_int16_t) { check_min_max<int16_t>(); }
+
+TEST(reduce_kernels, check_min_max_uint16_t) { check_min_max<uint16_t>(); }
+
+TEST(reduce_kernels, check_min_max_int32_t) { check_min_max<int32_t>(); }
+
+TEST(reduce_kernels, check_min_max_uint32_t) { check_min_max<uint32_t>(); }
+
+TEST(reduce_kernels, check_min_max_int64_t) { check_min_max<int64_t>(); }
+
+TEST(reduce_kernels, check_min_max_uint64_t) { check_min_max<uint64_t>(); }
+
+TEST(reduce_kernels, check_min_max_float) { check_min_max<float>(); }
+
+TEST(reduce_kernels, check_min_max_double) { check_min_max<double>(); }
+
+TEST(reduce_kernels, check_min_max_leading_nan) {
+  std::vector<double> vec(100, 1.0);
+  vec[0] = std::numeric_limits<double>::quiet_NaN();
+  vec[50] = -1.0;
+  for (auto isa : available_isas()) {
+    ppc::reference::kernels::set_isa_limit(isa);
+    EXPECT_EQ(ppc::reference::kernels::min_index(vec.data(), vec.size()),
+              static_cast<size_t>(std::min_element(vec.begin(), vec.end()) - vec.begin()));
+    EXPECT_EQ(ppc::reference::kernels::max_index(vec.data(), vec.size()),
+              static_cast<size_t>(std::max_element(vec.begin(), vec.end()) - vec.begin()));
+  }
+  ppc::reference::kernels::set_isa_limit(Isa::AVX512);
+}
+
+TEST(reduce_kernels, check_arg_extremum_omp) { check_arg_extremum_parallel<int8_t, ppc::reference::exec::omp>(); }
+
+TEST(reduce_kernels, check_arg_extremum_tbb) { check_arg_extremum_parallel<uint32_t, ppc::reference::exec::tbb>(); }
+
+TEST(reduce_kernels, check_arg_extremum_stl) { check_arg_extremum_parallel<double, ppc::reference::exec::stl>(); }
+
+TEST(reduce_kernels, check_arg_extremum_float) { check_arg_extremum_parallel<float, ppc::reference::exec::omp>(); }
+
+TEST(reduce_kernels, check_arg_extremum_leading_nan) {
+  std::vector<float> vec(4 * ppc::reference::exec::kMinChunk, 1.0F);
+  vec[0] = std::numeric_limits<float>::quiet_NaN();
+  vec[vec.size() / 2] = -1.0F;
+  ppc::reference::exec::set_concurrency(4);
+  EXPECT_EQ(ppc::reference::kernels::argmin<ppc::reference::exec::stl>(vec.data(), vec.size()).index, 0U);
+  EXPECT_EQ(ppc::reference::kernels::argmax<ppc::reference::exec::stl>(vec.data(), vec.size()).index, 0U);
+  ppc::reference::exec::set_concurrency(0);
+}
@@ -0,0 +1,94 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "ref/kernels/func_tests/test_utils.hpp"
+#include "ref/kernels/include/parallel.hpp"
+#include "ref/kernels/include/segmented.hpp"
+
+namespace {
+
+using ppc::reference::test::random_vector;
+
+// many short segments, a few empty ones and two long enough to be split
+std::vector<uint64_t> skewed_offsets(unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<uint64_t> short_length(0, 40);
+  std::vector<uint64_t> offsets = {0};
+  for (size_t s = 0; s < 3000; s++) {
+    uint64_t length = short_length(gen);
+    if (s == 7 || s == 2000) length = 5 * ppc::reference::exec::kMinChunk + 3;
+    offsets.push_back(offsets.back() + length);
+  }
+  offsets.push_back(offsets.back());
+  return offsets;
+}
+
+template <class Policy>
+void check_segmented() {
+  ppc::reference::exec::set_concurrency(4);
+  auto offsets = skewed_offsets(1);
+  const size_t segments = offsets.size() - 1;
+  auto x = random_vector<int32_t>(offsets.back(), -1000, 1000, 2);
+  auto y = random_vector<int32_t>(offsets.back(), -1000, 1000, 3);
+
+  std::vector<int> visits(segments, 0);
+  ppc::reference::kernels::for_each_segment<Policy>(
+      offsets.data(), segments, [&](size_t s, size_t, size_t) { visits[s]++; },
+      [&](size_t s, size_t, size_t) { visits[s]++; });
+  EXPECT_EQ(std::count(visits.begin(), visits.end(), 1), static_cast<std::ptrdiff_t>(segments));
+
+  std::vector<int64_t> sums(segments);
+  std::vector<int32_t> dots(segments);
+  ppc::reference::kernels::segmented_sum<Policy>(x.data(), offsets.data(), segments, sums.data());
+  ppc::reference::kernels::segmented_dot<Policy>(x.data(), y.data(), offsets.data(), segments, dots.data());
+  for (size_t s = 0; s < segments; s++) {
+    int64_t sum = 0;
+    uint32_t dot = 0;
+    for (auto i = offsets[s]; i < offsets[s + 1]; i++) {
+      sum += x[i];
+      dot += static_cast<uint32_t>(x[i]) * static_cast<uint32_t>(y[i]);
+    }
+    EXPECT_EQ(sums[s], sum) << "segment " << s;
+    EXPECT_EQ(dots[s], static_cast<int32_t>(dot)) << "segment " << s;
+  }
+
+  // drop the empty segments for min and max
+  std::vector<uint64_t> non_empty = {0};
+  for (size_t s = 0; s < segments; s++) {
+    if (offsets[s + 1] > offsets[s]) non_empty.push_back(offsets[s + 1]);
+  }
+  std::vector<int32_t> values(non_empty.size() - 1);
+  std::vector<uint64_t> indices(non_empty.size() - 1);
+  ppc::reference::kernels::segmented_extremum<true, Policy>(x.data(), non_empty.data(), values.size(), values.data(),
+                                                            indices.data());
+  for (size_t s = 0; s < values.size(); s++) {
+    auto begin = x.begin() + static_cast<std::ptrdiff_t>(non_empty[s]);
+    auto end = x.begin() + static_cast<std::ptrdiff_t>(non_empty[s + 1]);
+    EXPECT_EQ(indices[s], static_cast<uint64_t>(std::max_element(begin, end) - begin)) << "segment " << s;
+    EXPECT_EQ(values[s], *std::max_element(begin, end)) << "segment " << s;
+  }
+  ppc::reference::exec::set_concurrency(0);
+}
+
+}  // namespace
+
+TEST(segmented_kernels, check_seq) { check_segmented<ppc::reference::exec::seq>(); }
+
+TEST(segmented_kernels, check_omp) { check_segmented<ppc::reference::exec::omp>(); }
+
+TEST(segmented_kernels, check_tbb) { check_segmented<ppc::reference::exec::tbb>(); }
+
+TEST(segmented_kernels, check_stl) { check_segmented<ppc::reference::exec::stl>(); }
+
+TEST(segmented_kernels, check_no_segments) {
+  std::vector<uint64_t> offsets = {0};
+  int calls = 0;
+  ppc::reference::kernels::for_each_segment<ppc::reference::exec::stl>(
+      offsets.data(), 0, [&](size_t, size_t, size_t) { calls++; }, [&](size_t, size_t, size_t) { calls++; });
+  EXPECT_EQ(calls, 0);
+}
@@ -0,0 +1,134 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "ref/kernels/func_tests/test_utils.hpp"
+#include "ref/kernels/include/accumulator.hpp"
+#include "ref/kernels/include/isa.hpp"
+#include "ref/kernels/include/parallel.hpp"
+#include "ref/kernels/include/reduce.hpp"
+#include "ref/kernels/include/statistics.hpp"
+
+namespace {
+
+using ppc::reference::kernels::Isa;
+using ppc::reference::test::available_isas;
+using ppc::reference::test::random_vector;
+using ppc::reference::test::sizes;
+
+template <class T>
+void expect_statistics(const ppc::reference::kernels::Statistics<T>& stats, const std::vector<T>& vec) {
+  ppc::reference::kernels::accumulator_t<T> sum = 0;
+  size_t sign_changes = 0;
+  for (size_t i = 0; i < vec.size(); i++) {
+    sum += vec[i];
+    if (i + 1 < vec.size() && ((vec[i] < 0 && vec[i + 1] > 0) || (vec[i] > 0 && vec[i + 1] < 0))) sign_changes++;
+  }
+  const double mean = static_cast<double>(sum) / static_cast<double>(vec.size());
+  double m2 = 0;
+  for (auto x : vec) m2 += (x - mean) * (x - mean);
+
+  EXPECT_EQ(stats.count, vec.size());
+  EXPECT_EQ(stats.sum, sum);
+  EXPECT_NEAR(stats.mean, mean, 1e-9 * (1 + std::abs(mean)));
+  EXPECT_NEAR(stats.variance(), m2 / static_cast<double>(vec.size()), 1e-9 * (1 + m2));
+  EXPECT_EQ(stats.min.index, static_cast<size_t>(std::min_element(vec.begin(), vec.end()) - vec.begin()));
+  EXPECT_EQ(stats.max.index, static_cast<size_t>(std::max_element(vec.begin(), vec.end()) - vec.begin()));
+  EXPECT_EQ(stats.min.value, vec[stats.min.index]);
+  EXPECT_EQ(stats.max.value, vec[stats.max.index]);
+  EXPECT_EQ(stats.sign_changes, sign_changes);
+}
+
+template <class T>
+void check_statistics() {
+  const int64_t lo = std::is_signed_v<T> ? -50 : 0;
+  for (auto isa : available_isas()) {
+    ppc::reference::kernels::set_isa_limit(isa);
+    for (auto n : sizes) {
+      auto vec = random_vector<T>(n, lo, lo + 100, static_cast<unsigned>(n));
+      SCOPED_TRACE(n);
+      expect_statistics(ppc::reference::kernels::statistics(vec.data(), n), vec);
+    }
+  }
+  ppc::reference::kernels::set_isa_limit(Isa::AVX512);
+}
+
+template <class Policy>
+void check_statistics_parallel() {
+  const size_t n = 4 * ppc::reference::exec::kMinChunk + 9;
+  ppc::reference::exec::set_concurrency(4);
+  auto vec = random_vector<int16_t>(n, -3, 3, 5);
+  // the extremes repeat in several chunks, the first occurrence wins
+  for (size_t c = 0; c < 4; c++) {
+    vec[n * c / 4 + 3] = 1000;
+    vec[n * c / 4 + 5] = -1000;
+  }
+  expect_statistics(ppc::reference::kernels::statistics<Policy>(vec.data(), n), vec);
+  ppc::reference::exec::set_concurrency(0);
+}
+
+}  // namespace
+
+TEST(statistics_kernels, check_int8_t) { check_statistics<int8_t>(); }
+
+TEST(statistics_kernels, check_uint8_t) { check_statistics<uint8_t>(); }
+
+TEST(statistics_kernels, check_int32_t) { check_statistics<int32_t>(); }
+
+TEST(statistics_kernels, check_uint64_t) { check_statistics<uint64_t>(); }
+
+TEST(statistics_kernels, check_float) { check_statistics<float>(); }
+
+TEST(statistics_kernels, check_double) { check_statistics<double>(); }
+
+TEST(statistics_kernels, check_variance_is_stable) {
+  // a large offset cancels catastrophically in a naive sum of squares
+  std::vector<double> vec(100000);
+  for (size_t i = 0; i < vec.size(); i++) vec[i] = 1e9 + static_cast<double>(i % 2);
+  auto stats = ppc::reference::kernels::statistics(vec.data(), vec.size());
+  EXPECT_NEAR(stats.variance(), 0.25, 1e-9);
+}
+
+// NaNs in the first vector of lanes are skipped at every ISA level the same
+// as argmin and argmax skip them, a NaN in front wins
+TEST(statistics_kernels, check_min_max_skip_nan) {
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  std::vector<float> vec(64);
+  for (size_t i = 0; i < vec.size(); i++) vec[i] = 10.0F + static_cast<float>(i);
+  vec[1] = nan;
+  vec[33] = -5.0F;
+  vec[35] = 500.0F;
+  for (auto isa : available_isas()) {
+    ppc::reference::kernels::set_isa_limit(isa);
+    auto stats = ppc::reference::kernels::statistics(vec.data(), vec.size());
+    auto min = ppc::reference::kernels::argmin(vec.data(), vec.size());
+    auto max = ppc::reference::kernels::argmax(vec.data(), vec.size());
+    EXPECT_EQ(stats.min.index, 33U);
+    EXPECT_EQ(stats.max.index, 35U);
+    EXPECT_EQ(stats.min.index, min.index);
+    EXPECT_EQ(stats.max.index, max.index);
+    EXPECT_EQ(stats.min.value, -5.0F);
+    EXPECT_EQ(stats.max.value, 500.0F);
+
+    auto leading = vec;
+    leading[0] = nan;
+    stats = ppc::reference::kernels::statistics(leading.data(), leading.size());
+    EXPECT_TRUE(std::isnan(stats.min.value));
+    EXPECT_TRUE(std::isnan(stats.max.value));
+    EXPECT_EQ(stats.min.index, 0U);
+    EXPECT_EQ(stats.max.index, 0U);
+  }
+  ppc::reference::kernels::set_isa_limit(Isa::AVX512);
+}
+
+TEST(statistics_kernels, check_parallel_omp) { check_statistics_parallel<ppc::reference::exec::omp>(); }
+
+TEST(statistics_kernels, check_parallel_tbb) { check_statistics_parallel<ppc::reference::exec::tbb>(); }
+
+TEST(statistics_kernels, check_parallel_stl) { check_statistics_parallel<ppc::reference::exec::stl>(); }
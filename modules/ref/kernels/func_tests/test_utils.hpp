@@ -0,0 +1,96 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_KERNELS_TEST_UTILS_HPP_
+#define MODULES_REFERENCE_KERNELS_TEST_UTILS_HPP_
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "ref/kernels/include/isa.hpp"
+#include "ref/kernels/include/parallel.hpp"
+
+#ifdef USE_MPI
+#include <mpi.h>
+#endif
+
+namespace ppc::reference::test {
+
+// every instruction set level supported by the machine, scalar included
+inline std::vector<kernels::Isa> available_isas() {
+  std::vector<kernels::Isa> isas;
+  for (auto isa : {kernels::Isa::SCALAR, kernels::Isa::SSE2, kernels::Isa::AVX2, kernels::Isa::AVX512}) {
+    if (isa <= kernels::detected_isa()) isas.push_back(isa);
+  }
+  return isas;
+}
+
+// sizes around the vector widths and the unrolled block lengths
+inline const std::vector<std::size_t> sizes = {1,  2,  3,   7,   15,  16,  17,   31,  33,
+                                                63, 64, 65, 127, 255, 256, 257, 1000, 4099};
+
+template <class T>
+std::vector<T> random_vector(std::size_t n, int64_t lo, int64_t hi, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int64_t> dist(lo, hi);
+  std::vector<T> vec(n);
+  for (auto& x : vec) {
+    x = static_cast<T>(dist(gen));
+  }
+  return vec;
+}
+
+// path of a temporary file unique to this process, so that concurrent test
+// processes (e.g. one per MPI rank) never share a file
+inline std::string temp_path(const std::string& name) {
+  static const auto suffix = std::to_string(std::random_device{}());
+  return (std::filesystem::temp_directory_path() / (suffix + "_" + name)).string();
+}
+
+// Runs the whole pipeline of a valid task
+inline void run_task(ppc::core::Task& task) {
+  ASSERT_EQ(task.validation(), true);
+  task.pre_processing();
+  task.run();
+  task.post_processing();
+}
+
+// Sets the number of workers of the parallel policies for its lifetime, by
+// default enough of them to split the input even on machines with few cores
+class ScopedConcurrency {
+ public:
+  explicit ScopedConcurrency(std::size_t workers = 4)
+      : previous_(exec::detail::concurrency_override().load(std::memory_order_relaxed)) {
+    exec::set_concurrency(workers);
+  }
+  ~ScopedConcurrency() { exec::set_concurrency(previous_); }
+  ScopedConcurrency(const ScopedConcurrency&) = delete;
+  ScopedConcurrency& operator=(const ScopedConcurrency&) = delete;
+
+ private:
+  std::size_t previous_;
+};
+
+#ifdef USE_MPI
+// The ref tests run on gtest_main, every test executable brings MPI up
+// around the whole run with AddGlobalTestEnvironment
+class MpiEnvironment : public ::testing::Environment {
+ public:
+  void SetUp() override {
+    int initialized = 0;
+    MPI_Initialized(&initialized);
+    if (initialized == 0) MPI_Init(nullptr, nullptr);
+  }
+  void TearDown() override { MPI_Finalize(); }
+};
+#endif
+
+}  // namespace ppc::reference::test
+
+#endif  // MODULES_REFERENCE_KERNELS_TEST_UTILS_HPP_
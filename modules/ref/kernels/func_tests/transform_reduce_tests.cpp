@@ -0,0 +1,159 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "ref/kernels/func_tests/test_utils.hpp"
+#include "ref/kernels/include/count.hpp"
+#include "ref/kernels/include/isa.hpp"
+#include "ref/kernels/include/parallel.hpp"
+#include "ref/kernels/include/reduce.hpp"
+#include "ref/kernels/include/transform_reduce.hpp"
+
+namespace {
+
+namespace kernels = ppc::reference::kernels;
+namespace ops = ppc::reference::kernels::ops;
+using ppc::reference::kernels::Isa;
+using ppc::reference::test::available_isas;
+using ppc::reference::test::random_vector;
+using ppc::reference::test::sizes;
+
+// A user operator: vectorized through the generic kernels without any SIMD code
+template <class T>
+struct CountEqualNeighbors : ops::PairCount<T> {
+  template <class X, class R>
+  static PPC_SIMD_INLINE void transform(const X& x, const X& y, R& out) {
+    kernels::detail::indicator(x == y, out);
+  }
+};
+
+// Not associative, so it has to be folded left to right
+struct Polynomial {
+  using argument_type = uint64_t;
+  using value_type = uint64_t;
+  using result_type = uint64_t;
+  static constexpr bool pairwise = false;
+  static constexpr bool associative = false;
+  static value_type identity() { return 0; }
+  static void transform(value_type x, value_type& out) { out = x; }
+  static void combine(value_type& acc, value_type x) { acc = acc * 31 + x; }
+  static result_type finish(value_type value) { return value; }
+};
+
+template <class T>
+void check_ops() {
+  for (auto isa : available_isas()) {
+    kernels::set_isa_limit(isa);
+    for (auto n : sizes) {
+      auto vec = random_vector<T>(n, std::is_signed_v<T> ? -3 : 0, 3, static_cast<unsigned>(n));
+      const auto* data = vec.data();
+      using Acc = kernels::accumulator_t<T>;
+      Acc sum = 0;
+      Acc squares = 0;
+      size_t equal = 0;
+      for (size_t i = 0; i < n; i++) {
+        sum += static_cast<Acc>(vec[i]);
+        squares += static_cast<Acc>(vec[i]) * static_cast<Acc>(vec[i]);
+        if (i + 1 < n && vec[i] == vec[i + 1]) equal++;
+      }
+      EXPECT_EQ(kernels::transform_reduce<ops::Sum<T>>(data, n), sum) << "n = " << n;
+      EXPECT_EQ(kernels::transform_reduce<ops::SumOfSquares<T>>(data, n), squares) << "n = " << n;
+      EXPECT_EQ(kernels::transform_reduce<ops::Min<T>>(data, n), *std::min_element(vec.begin(), vec.end()));
+      EXPECT_EQ(kernels::transform_reduce<ops::Max<T>>(data, n), *std::max_element(vec.begin(), vec.end()));
+      EXPECT_EQ(kernels::transform_reduce<ops::CountDescents<T>>(data, n), kernels::count_descents(data, n));
+      EXPECT_EQ(kernels::transform_reduce<ops::CountSignChanges<T>>(data, n), kernels::count_sign_changes(data, n));
+      EXPECT_EQ(kernels::transform_reduce<CountEqualNeighbors<T>>(data, n), equal) << "n = " << n;
+    }
+  }
+  kernels::set_isa_limit(Isa::AVX512);
+}
+
+}  // namespace
+
+TEST(kernels_transform_reduce, check_int8_t) { check_ops<int8_t>(); }
+
+TEST(kernels_transform_reduce, check_uint16_t) { check_ops<uint16_t>(); }
+
+TEST(kernels_transform_reduce, check_int32_t) { check_ops<int32_t>(); }
+
+TEST(kernels_transform_reduce, check_int64_t) { check_ops<int64_t>(); }
+
+TEST(kernels_transform_reduce, check_float) { check_ops<float>(); }
+
+TEST(kernels_transform_reduce, check_double) { check_ops<double>(); }
+
+TEST(kernels_transform_reduce, check_half) {
+  std::vector<kernels::half> vec(1000);
+  for (size_t i = 0; i < vec.size(); i++) vec[i] = kernels::half(static_cast<float>(i % 7) - 3.f);
+  EXPECT_EQ(kernels::transform_reduce<ops::Sum<kernels::half>>(vec.data(), vec.size()), -3.f);
+  EXPECT_EQ(kernels::transform_reduce<ops::Min<kernels::half>>(vec.data(), vec.size()), -3.f);
+  // only the 3 -> -3 steps between the periods change sign
+  EXPECT_EQ(kernels::transform_reduce<ops::CountSignChanges<kernels::half>>(vec.data(), vec.size()), 142U);
+}
+
+TEST(kernels_transform_reduce, check_empty_and_single) {
+  const int32_t one = 5;
+  EXPECT_EQ(kernels::transform_reduce<ops::Sum<int32_t>>(&one, 0), 0);
+  EXPECT_EQ(kernels::transform_reduce<ops::Max<int32_t>>(&one, 1), 5);
+  EXPECT_EQ(kernels::transform_reduce<ops::CountDescents<int32_t>>(&one, 1), 0U);
+}
+
+TEST(kernels_transform_reduce, check_min_max_skip_nan) {
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  std::vector<double> vec(1000);
+  for (size_t i = 0; i < vec.size(); i++) vec[i] = static_cast<double>(i % 97) - 40.0;
+  for (size_t i = 0; i < vec.size(); i += 13) vec[i] = nan;
+  const std::vector<double> nans(100, nan);
+  for (auto isa : available_isas()) {
+    kernels::set_isa_limit(isa);
+    // even the NaN in front is skipped, unlike in argmin and argmax
+    EXPECT_EQ(kernels::transform_reduce<ops::Min<double>>(vec.data(), vec.size()), -40.0);
+    EXPECT_EQ(kernels::transform_reduce<ops::Max<double>>(vec.data(), vec.size()), 56.0);
+    EXPECT_TRUE(std::isnan(kernels::argmin(vec.data(), vec.size()).value));
+    EXPECT_EQ(kernels::transform_reduce<ops::Min<double>>(nans.data(), nans.size()), ops::Min<double>::identity());
+    EXPECT_EQ(kernels::transform_reduce<ops::Max<double>>(nans.data(), nans.size()), ops::Max<double>::identity());
+  }
+  kernels::set_isa_limit(Isa::AVX512);
+}
+
+TEST(kernels_transform_reduce, check_fused_matches_separate) {
+  auto vec = random_vector<int32_t>(10007, -100, 100, 7);
+  const auto* data = vec.data();
+  using Stats = ops::Fused<ops::Sum<int32_t>, ops::Min<int32_t>, ops::Max<int32_t>, ops::CountSignChanges<int32_t>>;
+  const auto [sum, min, max, changes] = kernels::transform_reduce<Stats>(data, vec.size());
+  EXPECT_EQ(sum, kernels::transform_reduce<ops::Sum<int32_t>>(data, vec.size()));
+  EXPECT_EQ(min, kernels::transform_reduce<ops::Min<int32_t>>(data, vec.size()));
+  EXPECT_EQ(max, kernels::transform_reduce<ops::Max<int32_t>>(data, vec.size()));
+  // pairs straddling the fused blocks are counted once
+  EXPECT_EQ(changes, kernels::count_sign_changes(data, vec.size()));
+}
+
+TEST(kernels_transform_reduce, check_policies_match_seq) {
+  auto vec = random_vector<int64_t>(300000, -1000, 1000, 3);
+  const auto* data = vec.data();
+  using Stats = ops::Fused<ops::Sum<int64_t>, ops::CountDescents<int64_t>, ops::Max<int64_t>>;
+  const auto expected = kernels::transform_reduce<Stats>(data, vec.size());
+  ppc::reference::exec::set_concurrency(4);
+  EXPECT_EQ((kernels::transform_reduce<Stats, ppc::reference::exec::omp>(data, vec.size())), expected);
+  EXPECT_EQ((kernels::transform_reduce<Stats, ppc::reference::exec::tbb>(data, vec.size())), expected);
+  EXPECT_EQ((kernels::transform_reduce<Stats, ppc::reference::exec::stl>(data, vec.size())), expected);
+  EXPECT_EQ((kernels::transform_reduce<Stats, ppc::reference::exec::mpi>(data, vec.size())), expected);
+  ppc::reference::exec::set_concurrency(0);
+}
+
+TEST(kernels_transform_reduce, check_non_associative_in_order) {
+  std::vector<uint64_t> vec(100000);
+  for (size_t i = 0; i < vec.size(); i++) vec[i] = i * 7 + 1;
+  uint64_t expected = 0;
+  for (auto x : vec) expected = expected * 31 + x;
+  ppc::reference::exec::set_concurrency(4);
+  EXPECT_EQ((kernels::transform_reduce<Polynomial, ppc::reference::exec::stl>(vec.data(), vec.size())), expected);
+  ppc::reference::exec::set_concurrency(0);
+}
@@ -0,0 +1,45 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_KERNELS_ACCUMULATOR_HPP_
+#define MODULES_REFERENCE_KERNELS_ACCUMULATOR_HPP_
+
+#include <cstdint>
+#include <type_traits>
+
+namespace ppc::reference::kernels {
+
+// Type a reduction over T accumulates in so that it cannot overflow for any
+// realistic input: integers widen to 64 bits of the same signedness, float
+// widens to double. Specialize it to change the policy for a type.
+template <class T, class = void>
+struct accumulator_traits {
+  using type = T;
+};
+
+template <class T>
+struct accumulator_traits<T, std::enable_if_t<std::is_integral_v<T> && std::is_signed_v<T>>> {
+  using type = int64_t;
+};
+
+template <class T>
+struct accumulator_traits<T, std::enable_if_t<std::is_integral_v<T> && std::is_unsigned_v<T>>> {
+  using type = uint64_t;
+};
+
+template <>
+struct accumulator_traits<float> {
+  using type = double;
+};
+
+template <class T>
+using accumulator_t = typename accumulator_traits<T>::type;
+
+// Type an average over T sums in: 64-bit integers already fill their
+// accumulator and would wrap, so they are summed in double instead
+template <class T>
+using average_accumulator_t =
+    std::conditional_t<std::is_integral_v<T> && sizeof(T) == sizeof(int64_t), double, accumulator_t<T>>;
+
+}  // namespace ppc::reference::kernels
+
+#endif  // MODULES_REFERENCE_KERNELS_ACCUMULATOR_HPP_
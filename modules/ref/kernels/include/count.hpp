@@ -0,0 +1,147 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_KERNELS_COUNT_HPP_
+#define MODULES_REFERENCE_KERNELS_COUNT_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+#include "ref/kernels/include/isa.hpp"
+#include "ref/kernels/include/parallel.hpp"
+#include "ref/kernels/include/reduce.hpp"
+
+namespace ppc::reference::kernels {
+
+namespace detail {
+
+// Predicates over an adjacent pair (x, y) = (data[i], data[i + 1])
+enum class PairTest {
+  // x > y
+  DESCENT,
+  // x and y have strictly opposite signs, zeros never count
+  SIGN_CHANGE
+};
+
+template <PairTest Test, class T>
+bool pair_test(T x, T y) {
+  if constexpr (Test == PairTest::DESCENT) {
+    return x > y;
+  } else {
+    return (x < 0 && y > 0) || (x > 0 && y < 0);
+  }
+}
+
+template <PairTest Test, class T>
+std::size_t count_pairs_scalar(const T* data, std::size_t pairs) {
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < pairs; i++) {
+    count += pair_test<Test>(data[i], data[i + 1]) ? 1 : 0;
+  }
+  return count;
+}
+
+#ifdef PPC_SIMD_X86
+
+// The compare masks (all ones per matching lane) are subtracted from per-lane
+// counters of the element width; the counters are flushed into a scalar total
+// before they could wrap, so no temporaries are written.
+template <std::size_t Bytes, PairTest Test, class T>
+PPC_SIMD_INLINE std::size_t count_pairs_vec(const T* data, std::size_t pairs) {
+  using U = wrap_t<std::conditional_t<sizeof(T) == 8, int64_t, std::conditional_t<sizeof(T) == 4, int32_t, T>>>;
+  using TV = vec_t<T, Bytes>;
+  using UV = vec_t<U, Bytes>;
+  constexpr std::size_t lanes = Bytes / sizeof(T);
+  constexpr std::size_t max_block = std::min<uint64_t>(std::numeric_limits<U>::max(), uint64_t{1} << 30);
+
+  std::size_t count = 0;
+  std::size_t i = 0;
+  while (i + lanes <= pairs) {
+    const std::size_t iterations = std::min((pairs - i) / lanes, max_block);
+    UV counter = {};
+    for (std::size_t j = 0; j < iterations; j++, i += lanes) {
+      TV x, y;
+      std::memcpy(&x, data + i, sizeof(x));
+      std::memcpy(&y, data + i + 1, sizeof(y));
+      if constexpr (Test == PairTest::DESCENT) {
+        counter -= __builtin_convertvector(x > y, UV);
+      } else if constexpr (std::is_integral_v<T>) {
+        // sign bits differ and neither operand is zero
+        const TV zero = {};
+        counter -= __builtin_convertvector(((x ^ y) < zero) & (x != zero) & (y != zero), UV);
+      } else {
+        const TV zero = {};
+        counter -= __builtin_convertvector(((x < zero) & (y > zero)) | ((x > zero) & (y < zero)), UV);
+      }
+    }
+    for (std::size_t l = 0; l < lanes; l++) {
+      count += counter[l];
+    }
+  }
+  return count + count_pairs_scalar<Test>(data + i, pairs - i);
+}
+
+template <PairTest Test, class T>
+std::size_t count_pairs_sse2(const T* data, std::size_t pairs) {
+  return count_pairs_vec<16, Test>(data, pairs);
+}
+template <PairTest Test, class T>
+PPC_SIMD_TARGET_AVX2 std::size_t count_pairs_avx2(const T* data, std::size_t pairs) {
+  return count_pairs_vec<32, Test>(data, pairs);
+}
+template <PairTest Test, class T>
+PPC_SIMD_TARGET_AVX512 std::size_t count_pairs_avx512(const T* data, std::size_t pairs) {
+  return count_pairs_vec<64, Test>(data, pairs);
+}
+
+#endif  // PPC_SIMD_X86
+
+template <PairTest Test, class T>
+std::size_t count_pairs(const T* data, std::size_t pairs) {
+#ifdef PPC_SIMD_X86
+  switch (active_isa()) {
+    case Isa::AVX512:
+      return count_pairs_avx512<Test>(data, pairs);
+    case Isa::AVX2:
+      return count_pairs_avx2<Test>(data, pairs);
+    case Isa::SSE2:
+      return count_pairs_sse2<Test>(data, pairs);
+    default:
+      break;
+  }
+#endif
+  return count_pairs_scalar<Test>(data, pairs);
+}
+
+template <PairTest Test, class Policy, class T>
+std::size_t count_adjacent(const T* data, std::size_t n) {
+  if (n < 2) return 0;
+  // a chunk of pairs [begin, end) reads the elements [begin, end], so the
+  // pair straddling two chunks is counted exactly once
+  return exec::chunked_reduce<Policy>(
+      n - 1, [&](std::size_t begin, std::size_t end) { return count_pairs<Test>(data + begin, end - begin); },
+      std::plus<std::size_t>());
+}
+
+}  // namespace detail
+
+// Number of adjacent pairs with data[i] > data[i + 1]
+template <class Policy = exec::seq, class T>
+std::size_t count_descents(const T* data, std::size_t n) {
+  return detail::count_adjacent<detail::PairTest::DESCENT, Policy>(data, n);
+}
+
+// Number of adjacent pairs whose elements have strictly opposite signs, that
+// is data[i] * data[i + 1] < 0 evaluated without overflow
+template <class Policy = exec::seq, class T>
+std::size_t count_sign_changes(const T* data, std::size_t n) {
+  return detail::count_adjacent<detail::PairTest::SIGN_CHANGE, Policy>(data, n);
+}
+
+}  // namespace ppc::reference::kernels
+
+#endif  // MODULES_REFERENCE_KERNELS_COUNT_HPP_
@@ -0,0 +1,280 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_KERNELS_DOT_HPP_
+#define MODULES_REFERENCE_KERNELS_DOT_HPP_
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "ref/kernels/include/half.hpp"
+#include "ref/kernels/include/isa.hpp"
+#include "ref/kernels/include/parallel.hpp"
+#include "ref/kernels/include/reduce.hpp"
+
+namespace ppc::reference::kernels {
+
+// How floating point dot products are accumulated. Integer dot products are
+// exact modulo 2^bits of the element type in every mode.
+enum class Precision {
+  // independent FMA accumulators per vector lane, error grows with n
+  FAST,
+  // FAST blocks summed as a balanced tree, error grows with log(n)
+  PAIRWISE,
+  // Neumaier compensated summation of the products, error independent of n
+  // (each product is still rounded once)
+  COMPENSATED
+};
+
+namespace detail {
+
+// A running sum together with the accumulated rounding error of its additions
+template <class T>
+struct Compensated {
+  T sum;
+  T compensation;
+};
+
+template <class T>
+Compensated<T> neumaier_add(Compensated<T> acc, T value) {
+  if constexpr (std::is_floating_point_v<T>) {
+    const T t = acc.sum + value;
+    acc.compensation += std::abs(acc.sum) >= std::abs(value) ? (acc.sum - t) + value : (value - t) + acc.sum;
+    acc.sum = t;
+  } else {
+    acc.sum += value;
+  }
+  return acc;
+}
+
+template <class T>
+Compensated<T> combine(const Compensated<T>& lhs, const Compensated<T>& rhs) {
+  auto acc = neumaier_add(lhs, rhs.sum);
+  acc.compensation += rhs.compensation;
+  return acc;
+}
+
+template <class T>
+wrap_t<compute_t<T>> dot_fast_scalar(const T* x, const T* y, std::size_t n) {
+  using W = wrap_t<compute_t<T>>;
+  W acc[kAccumulators] = {};
+  std::size_t i = 0;
+  for (; i + kAccumulators <= n; i += kAccumulators) {
+    for (std::size_t k = 0; k < kAccumulators; k++) {
+      acc[k] += static_cast<W>(x[i + k]) * static_cast<W>(y[i + k]);
+    }
+  }
+  for (; i < n; i++) {
+    acc[0] += static_cast<W>(x[i]) * static_cast<W>(y[i]);
+  }
+  return static_cast<W>((acc[0] + acc[1]) + (acc[2] + acc[3]));
+}
+
+template <class T>
+Compensated<compute_t<T>> dot_compensated_scalar(const T* x, const T* y, std::size_t n) {
+  using C = compute_t<T>;
+  Compensated<C> acc{0, 0};
+  for (std::size_t i = 0; i < n; i++) {
+    acc = neumaier_add(acc, static_cast<C>(x[i]) * static_cast<C>(y[i]));
+  }
+  return acc;
+}
+
+#ifdef PPC_SIMD_X86
+
+template <std::size_t Bytes, class T>
+PPC_SIMD_INLINE wrap_t<compute_t<T>> dot_fast_vec(const T* x, const T* y, std::size_t n) {
+  using W = wrap_t<compute_t<T>>;
+  using WV = vec_t<W, Bytes>;
+  constexpr std::size_t lanes = Bytes / sizeof(W);
+
+  WV acc[kAccumulators] = {};
+  std::size_t i = 0;
+  for (; i + kAccumulators * lanes <= n; i += kAccumulators * lanes) {
+    for (std::size_t k = 0; k < kAccumulators; k++) {
+      // integers are multiplied in the unsigned type, so overflow wraps
+      WV a, b;
+      load_widened<Bytes>(x + i + k * lanes, a);
+      load_widened<Bytes>(y + i + k * lanes, b);
+      acc[k] += a * b;
+    }
+  }
+  acc[0] = (acc[0] + acc[1]) + (acc[2] + acc[3]);
+
+  W total = 0;
+  for (std::size_t l = 0; l < lanes; l++) {
+    total += acc[0][l];
+  }
+  return static_cast<W>(total + dot_fast_scalar(x + i, y + i, n - i));
+}
+
+template <std::size_t Bytes, class T>
+PPC_SIMD_INLINE Compensated<compute_t<T>> dot_compensated_vec(const T* x, const T* y, std::size_t n) {
+  using C = compute_t<T>;
+  using V = vec_t<C, Bytes>;
+  constexpr std::size_t lanes = Bytes / sizeof(C);
+
+  V sum[kAccumulators] = {};
+  V compensation[kAccumulators] = {};
+  std::size_t i = 0;
+  for (; i + kAccumulators * lanes <= n; i += kAccumulators * lanes) {
+    for (std::size_t k = 0; k < kAccumulators; k++) {
+      V a, b;
+      load_widened<Bytes>(x + i + k * lanes, a);
+      load_widened<Bytes>(y + i + k * lanes, b);
+      const V p = a * b;
+      const V t = sum[k] + p;
+      const V abs_sum = sum[k] < 0 ? -sum[k] : sum[k];
+      const V abs_p = p < 0 ? -p : p;
+      compensation[k] += abs_sum >= abs_p ? (sum[k] - t) + p : (p - t) + sum[k];
+      sum[k] = t;
+    }
+  }
+
+  Compensated<C> acc{0, 0};
+  for (std::size_t k = 0; k < kAccumulators; k++) {
+    for (std::size_t l = 0; l < lanes; l++) {
+      acc = neumaier_add(acc, sum[k][l]);
+      acc.compensation += compensation[k][l];
+    }
+  }
+  return combine(acc, dot_compensated_scalar(x + i, y + i, n - i));
+}
+
+template <class T>
+PPC_SIMD_CONTRACT wrap_t<compute_t<T>> dot_fast_sse2(const T* x, const T* y, std::size_t n) {
+  return dot_fast_vec<16>(x, y, n);
+}
+template <class T>
+PPC_SIMD_TARGET_AVX2 PPC_SIMD_CONTRACT wrap_t<compute_t<T>> dot_fast_avx2(const T* x, const T* y, std::size_t n) {
+  return dot_fast_vec<32>(x, y, n);
+}
+template <class T>
+PPC_SIMD_TARGET_AVX512 PPC_SIMD_CONTRACT wrap_t<compute_t<T>> dot_fast_avx512(const T* x, const T* y, std::size_t n) {
+  return dot_fast_vec<64>(x, y, n);
+}
+
+// No contraction here: the compensation needs the rounded product
+template <class T>
+Compensated<compute_t<T>> dot_compensated_sse2(const T* x, const T* y, std::size_t n) {
+  return dot_compensated_vec<16>(x, y, n);
+}
+template <class T>
+PPC_SIMD_TARGET_AVX2 Compensated<compute_t<T>> dot_compensated_avx2(const T* x, const T* y, std::size_t n) {
+  return dot_compensated_vec<32>(x, y, n);
+}
+template <class T>
+PPC_SIMD_TARGET_AVX512 Compensated<compute_t<T>> dot_compensated_avx512(const T* x, const T* y, std::size_t n) {
+  return dot_compensated_vec<64>(x, y, n);
+}
+
+inline bool has_avx512_bf16() {
+  static const bool supported = [] {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx512bf16") != 0;
+  }();
+  return supported;
+}
+
+// vdpbf16ps multiplies pairs of bfloat16 and adds both products to a float
+// lane in one instruction, the inputs are never widened. Like the hardware,
+// it treats subnormal inputs and results as zero.
+PPC_SIMD_TARGET("avx512f,avx512bw,avx512vl,avx512dq,avx2,fma,f16c,avx512bf16")
+inline float dot_fast_avx512_bf16(const bfloat16* x, const bfloat16* y, std::size_t n) {
+  constexpr std::size_t lanes = 32;
+  __m512 acc[kAccumulators];
+  for (auto& a : acc) a = _mm512_setzero_ps();
+  std::size_t i = 0;
+  for (; i + kAccumulators * lanes <= n; i += kAccumulators * lanes) {
+    for (std::size_t k = 0; k < kAccumulators; k++) {
+      const auto a = reinterpret_cast<__m512bh>(_mm512_loadu_si512(x + i + k * lanes));
+      const auto b = reinterpret_cast<__m512bh>(_mm512_loadu_si512(y + i + k * lanes));
+      acc[k] = _mm512_dpbf16_ps(acc[k], a, b);
+    }
+  }
+  acc[0] = _mm512_add_ps(_mm512_add_ps(acc[0], acc[1]), _mm512_add_ps(acc[2], acc[3]));
+  float partial[16];
+  _mm512_storeu_ps(partial, acc[0]);
+  float total = 0;
+  for (float p : partial) total += p;
+  return total + dot_fast_avx512(x + i, y + i, n - i);
+}
+
+#endif  // PPC_SIMD_X86
+
+template <class T>
+wrap_t<compute_t<T>> dot_fast(const T* x, const T* y, std::size_t n) {
+#ifdef PPC_SIMD_X86
+  switch (active_isa()) {
+    case Isa::AVX512:
+      if constexpr (std::is_same_v<T, bfloat16>) {
+        if (has_avx512_bf16()) return dot_fast_avx512_bf16(x, y, n);
+      }
+      return dot_fast_avx512(x, y, n);
+    case Isa::AVX2:
+      return dot_fast_avx2(x, y, n);
+    case Isa::SSE2:
+      return dot_fast_sse2(x, y, n);
+    default:
+      break;
+  }
+#endif
+  return dot_fast_scalar(x, y, n);
+}
+
+template <class T>
+Compensated<compute_t<T>> dot_compensated(const T* x, const T* y, std::size_t n) {
+#ifdef PPC_SIMD_X86
+  switch (active_isa()) {
+    case Isa::AVX512:
+      return dot_compensated_avx512(x, y, n);
+    case Isa::AVX2:
+      return dot_compensated_avx2(x, y, n);
+    case Isa::SSE2:
+      return dot_compensated_sse2(x, y, n);
+    default:
+      break;
+  }
+#endif
+  return dot_compensated_scalar(x, y, n);
+}
+
+// Length of the FAST leaves of the pairwise tree
+constexpr std::size_t kPairwiseBlock = 1024;
+
+template <class T>
+compute_t<T> dot_pairwise(const T* x, const T* y, std::size_t n) {
+  if (n <= kPairwiseBlock) return dot_fast(x, y, n);
+  const std::size_t half = (n / kPairwiseBlock + 1) / 2 * kPairwiseBlock;
+  return dot_pairwise(x, y, half) + dot_pairwise(x + half, y + half, n - half);
+}
+
+template <Precision Mode, class T>
+Compensated<wrap_t<compute_t<T>>> dot_chunk(const T* x, const T* y, std::size_t n) {
+  if constexpr (!std::is_floating_point_v<compute_t<T>> || Mode == Precision::FAST) {
+    return {dot_fast(x, y, n), 0};
+  } else if constexpr (Mode == Precision::PAIRWISE) {
+    return {dot_pairwise(x, y, n), 0};
+  } else {
+    return dot_compensated(x, y, n);
+  }
+}
+
+}  // namespace detail
+
+// Dot product of two vectors of n elements accumulated in T (float for half
+// and bfloat16). Integer products and sums wrap modulo 2^bits of T, floating
+// point ones follow Mode. Parallel policies compute chunks independently and
+// combine them in order.
+template <Precision Mode = Precision::FAST, class Policy = exec::seq, class T>
+compute_t<T> dot(const T* x, const T* y, std::size_t n) {
+  auto result = exec::chunked_reduce<Policy>(
+      n, [&](std::size_t begin, std::size_t end) { return detail::dot_chunk<Mode>(x + begin, y + begin, end - begin); },
+      detail::combine<detail::wrap_t<compute_t<T>>>);
+  return static_cast<compute_t<T>>(result.sum + result.compensation);
+}
+
+}  // namespace ppc::reference::kernels
+
+#endif  // MODULES_REFERENCE_KERNELS_DOT_HPP_
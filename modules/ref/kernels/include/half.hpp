@@ -0,0 +1,147 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_KERNELS_HALF_HPP_
+#define MODULES_REFERENCE_KERNELS_HALF_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "ref/kernels/include/accumulator.hpp"
+#include "ref/kernels/include/isa.hpp"
+
+namespace ppc::reference::kernels {
+
+namespace detail {
+
+inline uint32_t float_bits(float value) {
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+inline float bits_float(uint32_t bits) {
+  float value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+// IEEE binary16 to binary32 without F16C: the exponent and mantissa are moved
+// into place and rebased by a multiplication, which also normalizes subnormals
+inline float half_to_float(uint16_t half) {
+  float value = bits_float(static_cast<uint32_t>(half & 0x7fff) << 13) * 0x1p112f;
+  uint32_t bits = float_bits(value);
+  if (value >= 65536.0f) bits |= 255U << 23;  // infinities and NaNs
+  return bits_float(bits | static_cast<uint32_t>(half & 0x8000) << 16);
+}
+
+// binary32 to binary16, rounding to nearest even
+inline uint16_t float_to_half(float value) {
+  uint32_t bits = float_bits(value);
+  const uint32_t sign = bits & 0x80000000U;
+  bits ^= sign;
+  uint32_t half;
+  if (bits >= 0x47800000U) {
+    // too large for a half, infinity or NaN
+    half = bits > 0x7f800000U ? 0x7e00 : 0x7c00;
+  } else if (bits < 0x38800000U) {
+    // subnormal or zero: the addition rounds the mantissa at the right bit
+    constexpr uint32_t magic = ((127 - 15) + (23 - 10) + 1) << 23;
+    half = float_bits(bits_float(bits) + bits_float(magic)) - magic;
+  } else {
+    const uint32_t odd = (bits >> 13) & 1;
+    bits += (static_cast<uint32_t>(15 - 127) << 23) + 0xfff + odd;
+    half = bits >> 13;
+  }
+  return static_cast<uint16_t>(half | sign >> 16);
+}
+
+// bfloat16 is the upper half of a binary32
+inline float bfloat16_to_float(uint16_t bf) { return bits_float(static_cast<uint32_t>(bf) << 16); }
+
+inline uint16_t float_to_bfloat16(float value) {
+  const uint32_t bits = float_bits(value);
+  if ((bits & 0x7fffffffU) > 0x7f800000U) return static_cast<uint16_t>(bits >> 16 | 0x40);  // quiet NaN
+  return static_cast<uint16_t>((bits + 0x7fff + ((bits >> 16) & 1)) >> 16);
+}
+
+}  // namespace detail
+
+// 16 bit storage types for floating point data. The kernels read them as
+// float, widening in registers, and accumulate in float or double.
+struct half {
+  uint16_t bits;
+
+  half() = default;
+  explicit half(float value) : bits(detail::float_to_half(value)) {}
+  operator float() const { return detail::half_to_float(bits); }
+};
+
+struct bfloat16 {
+  uint16_t bits;
+
+  bfloat16() = default;
+  explicit bfloat16(float value) : bits(detail::float_to_bfloat16(value)) {}
+  operator float() const { return detail::bfloat16_to_float(bits); }
+};
+
+template <class T>
+constexpr bool is_half_v = std::is_same_v<T, half> || std::is_same_v<T, bfloat16>;
+
+// Type the kernels compute in for elements of type T
+template <class T>
+using compute_t = std::conditional_t<is_half_v<T>, float, T>;
+
+template <>
+struct accumulator_traits<half> {
+  using type = float;
+};
+
+template <>
+struct accumulator_traits<bfloat16> {
+  using type = float;
+};
+
+#ifdef PPC_SIMD_X86
+
+namespace detail {
+
+// Widens the next lanes half or bfloat16 elements to floats. The 16 byte
+// (SSE2) kernels have no F16C and convert half with integer operations, the
+// AVX2 and AVX-512 kernels let the compiler emit vcvtph2ps.
+template <std::size_t Bytes, class T, class FV>
+PPC_SIMD_INLINE void widen_half(const T* data, FV& out) {
+  constexpr std::size_t lanes = sizeof(FV) / sizeof(float);
+  using HV = vec_t<uint16_t, lanes * sizeof(uint16_t)>;
+  using UV = vec_t<uint32_t, lanes * sizeof(uint32_t)>;
+  HV bits;
+  std::memcpy(&bits, data, sizeof(bits));
+  if constexpr (std::is_same_v<T, bfloat16>) {
+    const UV wide = __builtin_convertvector(bits, UV) << 16;
+    std::memcpy(&out, &wide, sizeof(out));
+#if defined(__FLT16_MAX__)
+  } else if constexpr (Bytes >= 32) {
+    vec_t<_Float16, lanes * sizeof(_Float16)> h;
+    std::memcpy(&h, &bits, sizeof(h));
+    out = __builtin_convertvector(h, FV);
+#endif
+  } else {
+    const UV wide = __builtin_convertvector(bits, UV);
+    UV magnitude = (wide & 0x7fff) << 13;
+    std::memcpy(&out, &magnitude, sizeof(out));
+    out *= 0x1p112f;
+    std::memcpy(&magnitude, &out, sizeof(out));
+    magnitude |= __builtin_convertvector(out >= 65536.0f, UV) & (255U << 23);
+    magnitude |= (wide & 0x8000) << 16;
+    std::memcpy(&out, &magnitude, sizeof(out));
+  }
+}
+
+}  // namespace detail
+
+#endif  // PPC_SIMD_X86
+
+}  // namespace ppc::reference::kernels
+
+#endif  // MODULES_REFERENCE_KERNELS_HALF_HPP_
@@ -0,0 +1,134 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_KERNELS_INCREMENTAL_HPP_
+#define MODULES_REFERENCE_KERNELS_INCREMENTAL_HPP_
+
+#include <cstddef>
+#include <deque>
+#include <type_traits>
+#include <vector>
+
+#include "ref/kernels/include/accumulator.hpp"
+#include "ref/kernels/include/dot.hpp"
+#include "ref/kernels/include/reduce.hpp"
+
+namespace ppc::reference::kernels {
+
+// Sum of a growing series that is updated in O(k) per k appended elements.
+// With window = 0 it covers everything appended so far, otherwise only the
+// last window elements, which it keeps in a ring buffer to subtract them
+// again once they leave the window.
+template <class T, class Acc = accumulator_t<T>>
+class RunningSum {
+ public:
+  explicit RunningSum(std::size_t window = 0) : window_(window) { ring_.reserve(window); }
+
+  void append(const T* data, std::size_t k) {
+    if (window_ == 0) {
+      total_ = detail::neumaier_add(total_, static_cast<W>(sum<T, Acc>(data, k)));
+    } else if (k >= window_) {
+      // the whole window is replaced, the older elements are never looked at
+      ring_.assign(data + k - window_, data + k);
+      head_ = 0;
+      reset();
+    } else {
+      for (std::size_t i = 0; i < k; i++) push(data[i]);
+    }
+    seen_ += k;
+  }
+
+  Acc value() const { return static_cast<Acc>(total_.sum + total_.compensation); }
+  // elements the value covers
+  std::size_t count() const { return window_ == 0 || seen_ < window_ ? seen_ : window_; }
+  // elements appended so far
+  std::size_t seen() const { return seen_; }
+
+ private:
+  using W = detail::wrap_t<Acc>;
+
+  void push(T x) {
+    if (ring_.size() < window_) {
+      ring_.push_back(x);
+      total_ = detail::neumaier_add(total_, static_cast<W>(x));
+      return;
+    }
+    total_ = detail::neumaier_add(total_, static_cast<W>(-static_cast<W>(ring_[head_])));
+    total_ = detail::neumaier_add(total_, static_cast<W>(x));
+    ring_[head_] = x;
+    // floating point additions and subtractions leave rounding errors behind,
+    // so the sum is rebuilt once per window, which is still O(1) per element
+    if (++head_ == window_) {
+      head_ = 0;
+      if constexpr (std::is_floating_point_v<W>) reset();
+    }
+  }
+
+  void reset() { total_ = {static_cast<W>(sum<T, Acc>(ring_.data(), ring_.size())), W{0}}; }
+
+  std::size_t window_;
+  std::size_t seen_ = 0;
+  // the last window elements once full, ring_[head_] is the oldest of them
+  std::vector<T> ring_;
+  std::size_t head_ = 0;
+  detail::Compensated<W> total_{W{0}, W{0}};
+};
+
+// First smallest (IsMax = false) or largest element of a growing series with
+// its index in the series, updated in O(k) per k appended elements. With a
+// window it covers the last window elements through a monotonic deque: an
+// element is dropped as soon as a later one is strictly better, so the front
+// is the answer and every element is pushed and popped at most once. The
+// windowed mode requires inputs without NaNs.
+template <class T, bool IsMax>
+class RunningExtremum {
+ public:
+  explicit RunningExtremum(std::size_t window = 0) : window_(window) {}
+
+  void append(const T* data, std::size_t k) {
+    if (k == 0) return;
+    if (window_ == 0) {
+      if (seen_ == 0) {
+        best_ = IsMax ? argmax(data, k) : argmin(data, k);
+      } else if (!detail::is_nan(best_.value)) {
+        // a NaN is the answer only as the very first element, later ones are skipped
+        auto candidate = detail::arg_extremum<IsMax>(data, k);
+        candidate.index += seen_;
+        best_ = detail::better_of<IsMax>(best_, candidate);
+      }
+      seen_ += k;
+      return;
+    }
+    if (k > window_) {
+      // elements before the last window can never be the answer again
+      seen_ += k - window_;
+      data += k - window_;
+      k = window_;
+      deque_.clear();
+    }
+    for (std::size_t i = 0; i < k; i++) {
+      while (!deque_.empty() && detail::better<IsMax>(data[i], deque_.back().value)) deque_.pop_back();
+      deque_.push_back({data[i], seen_ + i});
+    }
+    seen_ += k;
+    while (deque_.front().index + window_ < seen_) deque_.pop_front();
+  }
+
+  // requires seen() > 0
+  Extremum<T> value() const { return window_ == 0 ? best_ : deque_.front(); }
+  std::size_t seen() const { return seen_; }
+
+ private:
+  std::size_t window_;
+  std::size_t seen_ = 0;
+  Extremum<T> best_{};
+  std::deque<Extremum<T>> deque_;
+};
+
+template <class T>
+using RunningMin = RunningExtremum<T, false>;
+template <class T>
+using RunningMax = RunningExtremum<T, true>;
+
+}  // namespace ppc::reference::kernels
+
+#endif  // MODULES_REFERENCE_KERNELS_INCREMENTAL_HPP_
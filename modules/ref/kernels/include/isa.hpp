@@ -0,0 +1,80 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_KERNELS_ISA_HPP_
+#define MODULES_REFERENCE_KERNELS_ISA_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+
+// Vector kernels are written with the GCC/Clang vector extensions and
+// compiled for several instruction sets at once through target attributes.
+// Other compilers and architectures get the scalar kernels only.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define PPC_SIMD_X86 1
+#define PPC_SIMD_INLINE inline __attribute__((always_inline))
+#define PPC_SIMD_TARGET(isa) __attribute__((target(isa)))
+#define PPC_SIMD_TARGET_AVX2 PPC_SIMD_TARGET("avx2,fma,f16c")
+#define PPC_SIMD_TARGET_AVX512 PPC_SIMD_TARGET("avx512f,avx512bw,avx512vl,avx512dq,avx2,fma,f16c")
+// Lets a * b + c compile to a fused multiply-add. GCC does not contract in
+// ISO C++ mode, Clang contracts within an expression by default.
+#if defined(__clang__)
+#define PPC_SIMD_CONTRACT
+#else
+#define PPC_SIMD_CONTRACT __attribute__((optimize("fp-contract=fast")))
+#endif
+#else
+#define PPC_SIMD_INLINE inline
+#endif
+
+namespace ppc::reference::kernels {
+
+// Instruction sets the kernels are dispatched between, ordered by width
+enum class Isa { SCALAR, SSE2, AVX2, AVX512 };
+
+inline Isa detected_isa() {
+  static const Isa isa = [] {
+#ifdef PPC_SIMD_X86
+    __builtin_cpu_init();
+    // F16C (half float conversions) came before AVX2 and is part of both levels
+    const bool avx2 =
+        __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") && __builtin_cpu_supports("f16c");
+    if (avx2 && __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+        __builtin_cpu_supports("avx512vl") && __builtin_cpu_supports("avx512dq")) {
+      return Isa::AVX512;
+    }
+    if (avx2) return Isa::AVX2;
+    if (__builtin_cpu_supports("sse2")) return Isa::SSE2;
+#endif
+    return Isa::SCALAR;
+  }();
+  return isa;
+}
+
+namespace detail {
+
+#ifdef PPC_SIMD_X86
+// Bytes / sizeof(T) lanes of T in one vector register
+template <class T, std::size_t Bytes>
+struct vec {
+  typedef T type __attribute__((vector_size(Bytes)));
+};
+template <class T, std::size_t Bytes>
+using vec_t = typename vec<T, Bytes>::type;
+#endif
+
+inline std::atomic<Isa>& isa_limit() {
+  static std::atomic<Isa> limit{Isa::AVX512};
+  return limit;
+}
+}  // namespace detail
+
+// Caps the instruction set the kernels may use (tests compare every level
+// against the scalar kernels, benchmarks measure each level separately)
+inline void set_isa_limit(Isa isa) { detail::isa_limit().store(isa, std::memory_order_relaxed); }
+
+inline Isa active_isa() { return std::min(detected_isa(), detail::isa_limit().load(std::memory_order_relaxed)); }
+
+}  // namespace ppc::reference::kernels
+
+#endif  // MODULES_REFERENCE_KERNELS_ISA_HPP_
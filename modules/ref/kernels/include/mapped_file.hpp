@@ -0,0 +1,89 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_KERNELS_MAPPED_FILE_HPP_
+#define MODULES_REFERENCE_KERNELS_MAPPED_FILE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+
+#include "ref/kernels/include/parallel.hpp"
+
+namespace ppc::reference::kernels {
+
+// Read-only memory mapping of a whole binary file. The pages are read on
+// first access and the kernel is told the file is read sequentially, so it
+// reads ahead aggressively; release() gives consumed pages back, which keeps
+// the resident set bounded while streaming over files larger than RAM.
+class MappedFile {
+ public:
+  MappedFile() = default;
+  // throws std::system_error if the file cannot be opened or mapped
+  explicit MappedFile(const std::string& path);
+  MappedFile(MappedFile&& other) noexcept;
+  MappedFile& operator=(MappedFile&& other) noexcept;
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  ~MappedFile();
+
+  const std::byte* data() const { return data_; }
+  // file size in bytes
+  std::size_t size() const { return size_; }
+
+  template <class T>
+  const T* as() const {
+    return reinterpret_cast<const T*>(data_);
+  }
+  template <class T>
+  std::size_t count() const {
+    return size_ / sizeof(T);
+  }
+
+  // Hints that bytes [begin, end) are about to be read
+  void prefetch(std::size_t begin, std::size_t end) const;
+  // Drops the whole pages inside bytes [begin, end) from the resident set;
+  // they are read from the file again if touched later
+  void release(std::size_t begin, std::size_t end) const;
+
+ private:
+  void unmap();
+
+  std::byte* data_ = nullptr;
+  std::size_t size_ = 0;
+#if defined(_WIN32)
+  void* mapping_ = nullptr;
+#endif
+};
+
+// Bytes of a file reduced between two releases by stream_reduce
+constexpr std::size_t kStreamWindow = std::size_t{64} << 20;
+
+// chunked_reduce over the n = file.count<T>() elements of a mapped file, one
+// window of window_bytes at a time: the next window is prefetched while the
+// workers reduce the current one, which is released afterwards, so at most
+// about two windows are resident. chunk_fn(begin, end) gets element indices
+// into file.as<T>(). Requires n > 0.
+template <class Policy, class T, class ChunkFn, class Combine>
+auto stream_reduce(const MappedFile& file, const ChunkFn& chunk_fn, const Combine& combine,
+                   std::size_t window_bytes = kStreamWindow) {
+  const std::size_t n = file.count<T>();
+  // whole blocks of kMinChunk elements, so deterministic policies split every window the same way
+  const std::size_t window = std::max<std::size_t>(window_bytes / sizeof(T) / exec::kMinChunk, 1) * exec::kMinChunk;
+  auto reduce_window = [&](std::size_t begin) {
+    const std::size_t end = std::min(n, begin + window);
+    if (end < n) file.prefetch(end * sizeof(T), std::min(n, end + window) * sizeof(T));
+    auto result = exec::chunked_reduce<Policy>(
+        end - begin, [&](std::size_t b, std::size_t e) { return chunk_fn(begin + b, begin + e); }, combine);
+    file.release(begin * sizeof(T), end * sizeof(T));
+    return result;
+  };
+  auto result = reduce_window(0);
+  for (std::size_t begin = window; begin < n; begin += window) {
+    result = combine(result, reduce_window(begin));
+  }
+  return result;
+}
+
+}  // namespace ppc::reference::kernels
+
+#endif  // MODULES_REFERENCE_KERNELS_MAPPED_FILE_HPP_
@@ -0,0 +1,223 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_KERNELS_MATRIX_HPP_
+#define MODULES_REFERENCE_KERNELS_MATRIX_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include "ref/kernels/include/isa.hpp"
+#include "ref/kernels/include/parallel.hpp"
+#include "ref/kernels/include/reduce.hpp"
+
+namespace ppc::reference::kernels {
+
+// Read-only rows x cols matrix, element (r, c) is data[r * row_stride + c * col_stride]
+template <class T>
+struct MatrixView {
+  const T* data;
+  std::size_t rows;
+  std::size_t cols;
+  std::size_t row_stride;
+  std::size_t col_stride;
+
+  static MatrixView row_major(const T* data, std::size_t rows, std::size_t cols) {
+    return {data, rows, cols, cols, 1};
+  }
+  static MatrixView col_major(const T* data, std::size_t rows, std::size_t cols) {
+    return {data, rows, cols, 1, rows};
+  }
+
+  const T& at(std::size_t r, std::size_t c) const { return data[r * row_stride + c * col_stride]; }
+  MatrixView transposed() const { return {data, cols, rows, col_stride, row_stride}; }
+  // rows [begin, end) as a matrix of their own
+  MatrixView row_block(std::size_t begin, std::size_t end) const {
+    return {data + begin * row_stride, end - begin, cols, row_stride, col_stride};
+  }
+};
+
+namespace detail {
+
+// Columns accumulated per pass over the rows, the accumulators stay in L1
+template <class Acc>
+constexpr std::size_t column_block() {
+  return (std::size_t{16} << 10) / sizeof(Acc);
+}
+
+// acc[c] += row[c] for c < cols
+template <class Acc, class T>
+void add_row_scalar(const T* row, std::size_t cols, wrap_t<Acc>* acc) {
+  for (std::size_t c = 0; c < cols; c++) {
+    acc[c] += static_cast<wrap_t<Acc>>(row[c]);
+  }
+}
+
+#ifdef PPC_SIMD_X86
+
+// Rows with unit column stride are added into the accumulators a column
+// block at a time, so every row is read as one contiguous stream.
+template <std::size_t Bytes, class Acc, class T>
+PPC_SIMD_INLINE void accumulate_rows_vec(const MatrixView<T>& m, wrap_t<Acc>* acc) {
+  using W = wrap_t<Acc>;
+  constexpr std::size_t lanes = Bytes / sizeof(W);
+  using AccVec = vec_t<W, Bytes>;
+  using InVec = vec_t<T, lanes * sizeof(T)>;
+
+  for (std::size_t begin = 0; begin < m.cols; begin += column_block<Acc>()) {
+    const std::size_t end = std::min(m.cols, begin + column_block<Acc>());
+    for (std::size_t r = 0; r < m.rows; r++) {
+      const T* row = m.data + r * m.row_stride;
+      std::size_t c = begin;
+      for (; c + lanes <= end; c += lanes) {
+        AccVec a;
+        InVec v;
+        std::memcpy(&a, acc + c, sizeof(a));
+        std::memcpy(&v, row + c, sizeof(v));
+        a += __builtin_convertvector(v, AccVec);
+        std::memcpy(acc + c, &a, sizeof(a));
+      }
+      add_row_scalar<Acc>(row + c, end - c, acc + c);
+    }
+  }
+}
+
+template <class Acc, class T>
+void accumulate_rows_sse2(const MatrixView<T>& m, wrap_t<Acc>* acc) {
+  accumulate_rows_vec<16, Acc>(m, acc);
+}
+template <class Acc, class T>
+PPC_SIMD_TARGET_AVX2 void accumulate_rows_avx2(const MatrixView<T>& m, wrap_t<Acc>* acc) {
+  accumulate_rows_vec<32, Acc>(m, acc);
+}
+template <class Acc, class T>
+PPC_SIMD_TARGET_AVX512 void accumulate_rows_avx512(const MatrixView<T>& m, wrap_t<Acc>* acc) {
+  accumulate_rows_vec<64, Acc>(m, acc);
+}
+
+#endif  // PPC_SIMD_X86
+
+// acc[c] += sum of column c over all rows of m
+template <class Acc, class T>
+void accumulate_rows(const MatrixView<T>& m, wrap_t<Acc>* acc) {
+  if (m.col_stride == 1) {
+#ifdef PPC_SIMD_X86
+    switch (active_isa()) {
+      case Isa::AVX512:
+        return accumulate_rows_avx512<Acc>(m, acc);
+      case Isa::AVX2:
+        return accumulate_rows_avx2<Acc>(m, acc);
+      case Isa::SSE2:
+        return accumulate_rows_sse2<Acc>(m, acc);
+      default:
+        break;
+    }
+#endif
+  }
+  for (std::size_t r = 0; r < m.rows; r++) {
+    for (std::size_t c = 0; c < m.cols; c++) {
+      acc[c] += static_cast<wrap_t<Acc>>(m.at(r, c));
+    }
+  }
+}
+
+// Most row blocks the tall column sums split into under a deterministic
+// policy, every block keeps a partial of m.cols sums until the final fold
+constexpr std::size_t kMaxColSumBlocks = 64;
+
+// Sum of row r along its elements
+template <class Acc, class T>
+Acc row_sum(const MatrixView<T>& m, std::size_t r) {
+  if (m.col_stride == 1) return sum<T, Acc>(m.data + r * m.row_stride, m.cols);
+  wrap_t<Acc> acc = 0;
+  for (std::size_t c = 0; c < m.cols; c++) {
+    acc += static_cast<wrap_t<Acc>>(m.at(r, c));
+  }
+  return static_cast<Acc>(acc);
+}
+
+}  // namespace detail
+
+// out[c] = sum of column c. Contiguous columns are summed one by one; for
+// contiguous rows the columns are accumulated side by side, in parallel over
+// column blocks for wide matrices and over row blocks for tall ones.
+template <class Policy = exec::seq, class Acc, class T>
+void col_sums(const MatrixView<T>& m, Acc* out);
+
+// out[r] = sum of row r. Contiguous rows are summed one by one in parallel
+// over row blocks; column-major matrices are reduced as the column sums of
+// their transpose.
+template <class Policy = exec::seq, class Acc, class T>
+void row_sums(const MatrixView<T>& m, Acc* out) {
+  if (m.col_stride != 1 && m.row_stride == 1) {
+    col_sums<Policy>(m.transposed(), out);
+    return;
+  }
+  const std::size_t grain = exec::kMinChunk / std::max<std::size_t>(m.cols, 1);
+  exec::chunked_for<Policy>(m.rows, grain, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t r = begin; r < end; r++) {
+      out[r] = detail::row_sum<Acc>(m, r);
+    }
+  });
+}
+
+template <class Policy, class Acc, class T>
+void col_sums(const MatrixView<T>& m, Acc* out) {
+  using W = detail::wrap_t<Acc>;
+  if (m.row_stride != 1 && m.col_stride == 1 && m.rows > m.cols) {
+    // tall: every row block accumulates its own partial column sums; the
+    // deterministic blocks grow with the rows, so their number stays bounded
+    std::size_t grain = exec::kMinChunk / std::max<std::size_t>(m.cols, 1);
+    if constexpr (exec::detail::is_deterministic_v<Policy>) {
+      grain = std::max(grain, (m.rows + detail::kMaxColSumBlocks - 1) / detail::kMaxColSumBlocks);
+    }
+    auto acc = exec::chunked_reduce<Policy>(
+        m.rows, grain,
+        [&](std::size_t begin, std::size_t end) {
+          std::vector<W> partial(m.cols, W{0});
+          detail::accumulate_rows<Acc>(m.row_block(begin, end), partial.data());
+          return partial;
+        },
+        [](std::vector<W> lhs, const std::vector<W>& rhs) {
+          for (std::size_t c = 0; c < lhs.size(); c++) lhs[c] += rhs[c];
+          return lhs;
+        });
+    std::transform(acc.begin(), acc.end(), out, [](W value) { return static_cast<Acc>(value); });
+    return;
+  }
+  if (m.row_stride != 1 && m.col_stride == 1) {
+    // wide: the column blocks are independent
+    const std::size_t grain = exec::kMinChunk / std::max<std::size_t>(m.rows, 1);
+    exec::chunked_for<Policy>(m.cols, grain, [&](std::size_t begin, std::size_t end) {
+      std::vector<W> acc(end - begin, W{0});
+      detail::accumulate_rows<Acc>(MatrixView<T>{m.data + begin, m.rows, end - begin, m.row_stride, 1}, acc.data());
+      std::transform(acc.begin(), acc.end(), out + begin, [](W value) { return static_cast<Acc>(value); });
+    });
+    return;
+  }
+  row_sums<Policy>(m.transposed(), out);
+}
+
+// Sum of all elements accumulated in T
+template <class Policy = exec::seq, class T>
+T total_sum(const MatrixView<T>& m) {
+  using W = detail::wrap_t<T>;
+  if (m.rows == 0 || m.cols == 0) return T{0};
+  const auto contiguous = [](const MatrixView<T>& v) { return v.col_stride == 1 && v.row_stride == v.cols; };
+  if (contiguous(m) || contiguous(m.transposed())) {
+    return static_cast<T>(exec::chunked_reduce<Policy>(
+        m.rows * m.cols,
+        [&](std::size_t begin, std::size_t end) { return static_cast<W>(sum(m.data + begin, end - begin)); },
+        [](W lhs, W rhs) { return static_cast<W>(lhs + rhs); }));
+  }
+  // reduce along the contiguous dimension first
+  const auto lines = m.col_stride != 1 && m.row_stride == 1 ? m.transposed() : m;
+  std::vector<T> partial(lines.rows);
+  row_sums<Policy>(lines, partial.data());
+  return sum(partial.data(), partial.size());
+}
+
+}  // namespace ppc::reference::kernels
+
+#endif  // MODULES_REFERENCE_KERNELS_MATRIX_HPP_
@@ -0,0 +1,168 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_KERNELS_NEIGHBORS_HPP_
+#define MODULES_REFERENCE_KERNELS_NEIGHBORS_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "ref/kernels/include/isa.hpp"
+#include "ref/kernels/include/parallel.hpp"
+#include "ref/kernels/include/reduce.hpp"
+
+namespace ppc::reference::kernels {
+
+namespace detail {
+
+// |x - y| without overflow: integers are subtracted in the unsigned type
+// of the same width, the larger operand first
+template <class T>
+wrap_t<T> distance(T x, T y) {
+  using D = wrap_t<T>;
+  return x > y ? static_cast<D>(static_cast<D>(x) - static_cast<D>(y))
+               : static_cast<D>(static_cast<D>(y) - static_cast<D>(x));
+}
+
+template <bool IsMax, class T>
+Extremum<wrap_t<T>> neighbors_scalar(const T* data, std::size_t pairs) {
+  Extremum<wrap_t<T>> best{distance(data[0], data[1]), 0};
+  for (std::size_t i = 1; i < pairs; i++) {
+    best = better_of<IsMax>(best, Extremum<wrap_t<T>>{distance(data[i], data[i + 1]), i});
+  }
+  return best;
+}
+
+#ifdef PPC_SIMD_X86
+
+// One pass over the pairs: every lane keeps its best distance and the
+// iteration it was seen at. The iteration counter has the lane width, so the
+// pairs are processed in blocks short enough for it not to wrap.
+template <std::size_t Bytes, bool IsMax, class T>
+PPC_SIMD_INLINE Extremum<wrap_t<T>> neighbors_vec(const T* data, std::size_t pairs) {
+  using D = wrap_t<T>;
+  using I = wrap_t<std::conditional_t<sizeof(T) == 8, int64_t, std::conditional_t<sizeof(T) == 4, int32_t, T>>>;
+  using TV = vec_t<T, Bytes>;
+  using DV = vec_t<D, Bytes>;
+  using IV = vec_t<I, Bytes>;
+  constexpr std::size_t lanes = Bytes / sizeof(T);
+  constexpr std::size_t max_block = std::min<uint64_t>(std::numeric_limits<I>::max(), uint64_t{1} << 30);
+
+  // writes through a reference: vectors are never passed by value across calls
+  auto load_distance = [data](std::size_t offset, DV& d) {
+    TV x, y;
+    std::memcpy(&x, data + offset, sizeof(x));
+    std::memcpy(&y, data + offset + 1, sizeof(y));
+    if constexpr (std::is_integral_v<T>) {
+      auto ux = __builtin_convertvector(x, DV);
+      auto uy = __builtin_convertvector(y, DV);
+      d = x > y ? ux - uy : uy - ux;
+    } else {
+      d = x > y ? x - y : y - x;
+    }
+  };
+
+  Extremum<D> best{distance(data[0], data[1]), 0};
+  std::size_t i = 0;
+  while (i + lanes <= pairs) {
+    const std::size_t iterations = std::min((pairs - i) / lanes, max_block);
+    IV ones;
+    for (std::size_t l = 0; l < lanes; l++) ones[l] = 1;
+    IV iteration = {};
+    IV best_iteration = {};
+    DV best_distance;
+    load_distance(i, best_distance);
+    for (std::size_t j = 1; j < iterations; j++) {
+      DV d;
+      load_distance(i + j * lanes, d);
+      iteration += ones;
+      auto mask = IsMax ? d > best_distance : d < best_distance;
+      if constexpr (std::is_floating_point_v<T>) {
+        // a lane that has only seen NaN takes the first number
+        mask = mask | ((best_distance != best_distance) & (d == d));
+      }
+      best_distance = mask ? d : best_distance;
+      best_iteration = mask ? iteration : best_iteration;
+    }
+    for (std::size_t l = 0; l < lanes; l++) {
+      best = better_of<IsMax>(best, Extremum<D>{best_distance[l], i + best_iteration[l] * lanes + l});
+    }
+    i += iterations * lanes;
+  }
+  for (; i < pairs; i++) {
+    best = better_of<IsMax>(best, Extremum<D>{distance(data[i], data[i + 1]), i});
+  }
+  return best;
+}
+
+template <bool IsMax, class T>
+Extremum<wrap_t<T>> neighbors_sse2(const T* data, std::size_t pairs) {
+  return neighbors_vec<16, IsMax>(data, pairs);
+}
+template <bool IsMax, class T>
+PPC_SIMD_TARGET_AVX2 Extremum<wrap_t<T>> neighbors_avx2(const T* data, std::size_t pairs) {
+  return neighbors_vec<32, IsMax>(data, pairs);
+}
+template <bool IsMax, class T>
+PPC_SIMD_TARGET_AVX512 Extremum<wrap_t<T>> neighbors_avx512(const T* data, std::size_t pairs) {
+  return neighbors_vec<64, IsMax>(data, pairs);
+}
+
+#endif  // PPC_SIMD_X86
+
+template <bool IsMax, class T>
+Extremum<wrap_t<T>> neighbors(const T* data, std::size_t pairs) {
+#ifdef PPC_SIMD_X86
+  switch (active_isa()) {
+    case Isa::AVX512:
+      return neighbors_avx512<IsMax>(data, pairs);
+    case Isa::AVX2:
+      return neighbors_avx2<IsMax>(data, pairs);
+    case Isa::SSE2:
+      return neighbors_sse2<IsMax>(data, pairs);
+    default:
+      break;
+  }
+#endif
+  return neighbors_scalar<IsMax>(data, pairs);
+}
+
+// Same rule as argmin over the distances: a NaN distance at the front wins,
+// later ones are skipped, and the first pair wins on ties
+template <bool IsMax, class Policy, class T>
+std::size_t extreme_neighbors(const T* data, std::size_t n) {
+  if (n < 2 || is_nan(distance(data[0], data[1]))) return 0;
+  // a chunk of pairs [begin, end) reads the elements [begin, end]
+  auto best = exec::chunked_reduce<Policy>(
+      n - 1,
+      [&](std::size_t begin, std::size_t end) {
+        auto chunk = neighbors<IsMax>(data + begin, end - begin);
+        chunk.index += begin;
+        return chunk;
+      },
+      better_of<IsMax, wrap_t<T>>);
+  return best.index;
+}
+
+}  // namespace detail
+
+// Index i of the adjacent pair (i, i + 1) with the smallest |data[i + 1] - data[i]|,
+// the first such pair on ties
+template <class Policy = exec::seq, class T>
+std::size_t nearest_neighbors(const T* data, std::size_t n) {
+  return detail::extreme_neighbors<false, Policy>(data, n);
+}
+
+// Index i of the adjacent pair (i, i + 1) with the largest |data[i + 1] - data[i]|,
+// the first such pair on ties
+template <class Policy = exec::seq, class T>
+std::size_t most_different_neighbors(const T* data, std::size_t n) {
+  return detail::extreme_neighbors<true, Policy>(data, n);
+}
+
+}  // namespace ppc::reference::kernels
+
+#endif  // MODULES_REFERENCE_KERNELS_NEIGHBORS_HPP_
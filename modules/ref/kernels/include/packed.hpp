@@ -0,0 +1,412 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_KERNELS_PACKED_HPP_
+#define MODULES_REFERENCE_KERNELS_PACKED_HPP_
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#include "ref/kernels/include/accumulator.hpp"
+#include "ref/kernels/include/count.hpp"
+#include "ref/kernels/include/isa.hpp"
+#include "ref/kernels/include/neighbors.hpp"
+#include "ref/kernels/include/parallel.hpp"
+#include "ref/kernels/include/reduce.hpp"
+
+namespace ppc::reference::kernels {
+
+// Compressed integer vectors for data with a small dynamic range. The
+// elements are cut into blocks of kPackBlock, every block stores its values
+// as offsets from a reference in as few bits as its range needs:
+//   FOR    element i is reference + offset[i]
+//   DELTA  element i is element i - kPackLanes (the block start for the first
+//          row) + reference + offset[i], which suits smooth or sorted series
+// The offsets of a block are laid out in kPackLanes interleaved lanes of 32 bit
+// words (SIMD-BP128 style): row j of the block, elements [j * kPackLanes,
+// (j + 1) * kPackLanes), is unpacked by the same shifts in every lane, and
+// the delta decoding is a vertical add of consecutive rows.
+enum class Encoding : uint32_t { FOR, DELTA };
+
+constexpr std::size_t kPackLanes = 16;
+constexpr std::size_t kPackRows = 32;
+constexpr std::size_t kPackBlock = kPackLanes * kPackRows;
+// width of a block whose range does not fit in 32 bits, stored unencoded
+constexpr uint32_t kRawWidth = 64;
+
+// Buffer layout: a PackedHeader, one PackedBlock per block, then the payload
+struct PackedHeader {
+  uint64_t count;
+  Encoding encoding;
+  uint32_t element_size;
+};
+
+struct PackedBlock {
+  uint64_t reference;
+  // DELTA: the first element of the block
+  uint64_t start;
+  // 32 bit words from the payload start
+  uint64_t offset;
+  uint32_t width;
+  uint32_t reserved;
+};
+
+namespace detail {
+
+// Lane type the offsets are decoded in, wraps like T
+template <class T>
+using pack_lane_t = std::conditional_t<sizeof(T) == 8, uint64_t, uint32_t>;
+
+template <class T>
+std::size_t block_words(uint32_t width) {
+  return width == kRawWidth ? kPackBlock * sizeof(T) / sizeof(uint32_t) : kPackLanes * width;
+}
+
+template <class T>
+void decode_block_scalar(Encoding encoding, const PackedBlock& block, const uint32_t* words, T* out) {
+  using U = pack_lane_t<T>;
+  const uint32_t mask = block.width == 32 ? ~uint32_t{0} : (uint32_t{1} << block.width) - 1;
+  for (std::size_t lane = 0; lane < kPackLanes; lane++) {
+    auto prev = static_cast<U>(block.start);
+    for (std::size_t row = 0; row < kPackRows; row++) {
+      const std::size_t bit = row * block.width;
+      uint32_t v = 0;
+      if (block.width != 0) {
+        const std::size_t word = bit / 32;
+        const std::size_t shift = bit % 32;
+        v = words[word * kPackLanes + lane] >> shift;
+        if (shift + block.width > 32) v |= words[(word + 1) * kPackLanes + lane] << (32 - shift);
+        v &= mask;
+      }
+      auto x = static_cast<U>(static_cast<U>(v) + static_cast<U>(block.reference));
+      if (encoding == Encoding::DELTA) x = static_cast<U>(x + prev);
+      prev = x;
+      out[row * kPackLanes + lane] = static_cast<T>(x);
+    }
+  }
+}
+
+#ifdef PPC_SIMD_X86
+
+// Unpacks a whole block with vector shifts, Bytes / sizeof(lane) lanes of a
+// row at a time
+template <std::size_t Bytes, class T>
+PPC_SIMD_INLINE void decode_block_vec(Encoding encoding, const PackedBlock& block, const uint32_t* words, T* out) {
+  using U = pack_lane_t<T>;
+  constexpr std::size_t lanes = std::min(Bytes / sizeof(U), kPackLanes);
+  using UV = vec_t<U, lanes * sizeof(U)>;
+  using WV = vec_t<uint32_t, lanes * sizeof(uint32_t)>;
+  using TV = vec_t<T, lanes * sizeof(T)>;
+  const uint32_t width = block.width;
+  const uint32_t mask = width == 32 ? ~uint32_t{0} : (uint32_t{1} << width) - 1;
+  UV reference, start;
+  for (std::size_t l = 0; l < lanes; l++) {
+    reference[l] = static_cast<U>(block.reference);
+    start[l] = static_cast<U>(block.start);
+  }
+  const bool delta = encoding == Encoding::DELTA;
+
+  for (std::size_t lane = 0; lane < kPackLanes; lane += lanes) {
+    UV prev = start;
+    for (std::size_t row = 0; row < kPackRows; row++) {
+      WV v = {};
+      if (width != 0) {
+        const std::size_t bit = row * width;
+        const std::size_t word = bit / 32;
+        const auto shift = static_cast<uint32_t>(bit % 32);
+        std::memcpy(&v, words + word * kPackLanes + lane, sizeof(v));
+        v >>= shift;
+        if (shift + width > 32) {
+          WV next;
+          std::memcpy(&next, words + (word + 1) * kPackLanes + lane, sizeof(next));
+          v |= next << (32 - shift);
+        }
+        v &= mask;
+      }
+      UV x = __builtin_convertvector(v, UV) + reference;
+      if (delta) x += prev;
+      prev = x;
+      const TV values = __builtin_convertvector(x, TV);
+      std::memcpy(out + row * kPackLanes + lane, &values, sizeof(values));
+    }
+  }
+}
+
+template <class T>
+void decode_block_sse2(Encoding encoding, const PackedBlock& block, const uint32_t* words, T* out) {
+  decode_block_vec<16>(encoding, block, words, out);
+}
+template <class T>
+PPC_SIMD_TARGET_AVX2 void decode_block_avx2(Encoding encoding, const PackedBlock& block, const uint32_t* words,
+                                            T* out) {
+  decode_block_vec<32>(encoding, block, words, out);
+}
+template <class T>
+PPC_SIMD_TARGET_AVX512 void decode_block_avx512(Encoding encoding, const PackedBlock& block, const uint32_t* words,
+                                                T* out) {
+  decode_block_vec<64>(encoding, block, words, out);
+}
+
+#endif  // PPC_SIMD_X86
+
+template <class T>
+std::size_t bit_width(pack_lane_t<T> range) {
+  return static_cast<std::size_t>(std::bit_width(range));
+}
+
+}  // namespace detail
+
+// Read-only view of a buffer produced by pack<T>
+template <class T>
+class PackedView {
+ public:
+  PackedView() = default;
+  PackedView(const uint8_t* buffer, std::size_t bytes) : buffer_(buffer), bytes_(bytes) {}
+
+  // false for a buffer that is truncated or was packed from another type
+  bool valid() const {
+    if (bytes_ < sizeof(PackedHeader)) return false;
+    const auto& h = header();
+    if (h.element_size != sizeof(T) || (h.encoding != Encoding::FOR && h.encoding != Encoding::DELTA)) return false;
+    if (blocks() > (bytes_ - sizeof(PackedHeader)) / sizeof(PackedBlock)) return false;
+    std::size_t words = 0;
+    for (std::size_t b = 0; b < blocks(); b++) {
+      const auto& info = block(b);
+      if (info.offset != words || (info.width > 32 && info.width != kRawWidth)) return false;
+      if (info.width == kRawWidth && sizeof(T) != 8) return false;
+      words += detail::block_words<T>(info.width);
+    }
+    return bytes_ >= sizeof(PackedHeader) + blocks() * sizeof(PackedBlock) + words * sizeof(uint32_t);
+  }
+
+  std::size_t size() const { return static_cast<std::size_t>(header().count); }
+  std::size_t blocks() const { return (size() + kPackBlock - 1) / kPackBlock; }
+  Encoding encoding() const { return header().encoding; }
+
+  // Decodes block b into out[0, kPackBlock) and returns how many of the
+  // elements belong to the vector (fewer for the last block)
+  std::size_t decode(std::size_t b, T* out) const {
+    const auto& info = block(b);
+    const uint32_t* words = payload() + info.offset;
+    if (info.width == kRawWidth) {
+      std::memcpy(out, words, kPackBlock * sizeof(T));
+    } else {
+#ifdef PPC_SIMD_X86
+      switch (active_isa()) {
+        case Isa::AVX512:
+          detail::decode_block_avx512(encoding(), info, words, out);
+          break;
+        case Isa::AVX2:
+          detail::decode_block_avx2(encoding(), info, words, out);
+          break;
+        case Isa::SSE2:
+          detail::decode_block_sse2(encoding(), info, words, out);
+          break;
+        default:
+          detail::decode_block_scalar(encoding(), info, words, out);
+          break;
+      }
+#else
+      detail::decode_block_scalar(encoding(), info, words, out);
+#endif
+    }
+    return std::min(kPackBlock, size() - b * kPackBlock);
+  }
+
+  // First element of block b without decoding the block
+  T first(std::size_t b) const {
+    const auto& info = block(b);
+    const uint32_t* words = payload() + info.offset;
+    if (info.width == kRawWidth) {
+      T value;
+      std::memcpy(&value, words, sizeof(value));
+      return value;
+    }
+    using U = detail::pack_lane_t<T>;
+    const uint32_t mask = info.width == 32 ? ~uint32_t{0} : (uint32_t{1} << info.width) - 1;
+    const uint32_t offset = info.width == 0 ? 0 : words[0] & mask;
+    auto x = static_cast<U>(static_cast<U>(offset) + static_cast<U>(info.reference));
+    if (encoding() == Encoding::DELTA) x = static_cast<U>(x + static_cast<U>(info.start));
+    return static_cast<T>(x);
+  }
+
+ private:
+  const PackedHeader& header() const { return *reinterpret_cast<const PackedHeader*>(buffer_); }
+  const PackedBlock& block(std::size_t b) const {
+    return reinterpret_cast<const PackedBlock*>(buffer_ + sizeof(PackedHeader))[b];
+  }
+  const uint32_t* payload() const {
+    return reinterpret_cast<const uint32_t*>(buffer_ + sizeof(PackedHeader) + blocks() * sizeof(PackedBlock));
+  }
+
+  const uint8_t* buffer_ = nullptr;
+  std::size_t bytes_ = 0;
+};
+
+// Packs n integers; every block takes the fewest bits its range allows
+template <class T>
+std::vector<uint8_t> pack(const T* data, std::size_t n, Encoding encoding) {
+  static_assert(std::is_integral_v<T>, "only integers can be packed");
+  using U = detail::pack_lane_t<T>;
+  using S = std::make_signed_t<U>;
+  const std::size_t blocks = (n + kPackBlock - 1) / kPackBlock;
+  std::vector<PackedBlock> directory(blocks);
+  std::vector<uint32_t> payload;
+  std::vector<U> codes(kPackBlock);
+
+  for (std::size_t b = 0; b < blocks; b++) {
+    const std::size_t begin = b * kPackBlock;
+    const std::size_t len = std::min(kPackBlock, n - begin);
+    // the tail of the last block repeats its last element
+    auto element = [&](std::size_t i) { return data[begin + std::min(i, len - 1)]; };
+    auto& info = directory[b];
+    info.start = static_cast<uint64_t>(static_cast<U>(static_cast<S>(element(0))));
+    for (std::size_t i = 0; i < kPackBlock; i++) {
+      const auto x = static_cast<U>(static_cast<S>(element(i)));
+      if (encoding == Encoding::FOR) {
+        codes[i] = x;
+        continue;
+      }
+      const auto base =
+          i < kPackLanes ? static_cast<U>(info.start) : static_cast<U>(static_cast<S>(element(i - kPackLanes)));
+      codes[i] = static_cast<U>(x - base);
+    }
+    // the reference is the smallest code as a signed value, so negative
+    // deltas and signed elements get small offsets
+    const auto [lo, hi] = std::minmax_element(codes.begin(), codes.end(), [](U a, U c) {
+      return static_cast<S>(a) < static_cast<S>(c);
+    });
+    const auto reference = *lo;
+    const std::size_t width = detail::bit_width<T>(static_cast<U>(*hi - reference));
+    info.reference = static_cast<uint64_t>(reference);
+    info.offset = payload.size();
+
+    if (width > 32) {
+      info.width = kRawWidth;
+      payload.resize(payload.size() + detail::block_words<T>(kRawWidth));
+      for (std::size_t i = 0; i < kPackBlock; i++) {
+        const T x = element(i);
+        std::memcpy(payload.data() + info.offset + i * sizeof(T) / sizeof(uint32_t), &x, sizeof(x));
+      }
+      continue;
+    }
+    info.width = static_cast<uint32_t>(width);
+    payload.resize(payload.size() + detail::block_words<T>(info.width), 0);
+    uint32_t* words = payload.data() + info.offset;
+    for (std::size_t i = 0; i < kPackBlock && width != 0; i++) {
+      const std::size_t lane = i % kPackLanes;
+      const std::size_t bit = (i / kPackLanes) * width;
+      const auto offset = static_cast<uint64_t>(static_cast<U>(codes[i] - reference));
+      words[(bit / 32) * kPackLanes + lane] |= static_cast<uint32_t>(offset << (bit % 32));
+      if (bit % 32 + width > 32) {
+        words[(bit / 32 + 1) * kPackLanes + lane] |= static_cast<uint32_t>(offset >> (32 - bit % 32));
+      }
+    }
+  }
+
+  const PackedHeader header{n, encoding, sizeof(T)};
+  std::vector<uint8_t> buffer(sizeof(header) + directory.size() * sizeof(PackedBlock) +
+                              payload.size() * sizeof(uint32_t));
+  std::memcpy(buffer.data(), &header, sizeof(header));
+  std::memcpy(buffer.data() + sizeof(header), directory.data(), directory.size() * sizeof(PackedBlock));
+  std::memcpy(buffer.data() + sizeof(header) + directory.size() * sizeof(PackedBlock), payload.data(),
+              payload.size() * sizeof(uint32_t));
+  return buffer;
+}
+
+template <class T>
+std::vector<T> unpack(const PackedView<T>& packed) {
+  std::vector<T> out(packed.blocks() * kPackBlock);
+  for (std::size_t b = 0; b < packed.blocks(); b++) packed.decode(b, out.data() + b * kPackBlock);
+  out.resize(packed.size());
+  return out;
+}
+
+namespace detail {
+
+// chunked_reduce over the blocks, block_fn(b, values, len) gets block b
+// decoded into a buffer that stays in L1; values[len] is the first element
+// of the next block when there is one
+template <class Policy, class T, class BlockFn, class Combine>
+auto reduce_blocks(const PackedView<T>& packed, const BlockFn& block_fn, const Combine& combine) {
+  return exec::chunked_reduce<Policy>(
+      packed.blocks(), exec::kMinChunk / kPackBlock,
+      [&](std::size_t begin, std::size_t end) {
+        alignas(64) T values[kPackBlock + 1];
+        auto result = decltype(block_fn(begin, values, std::size_t{0})){};
+        for (std::size_t b = begin; b < end; b++) {
+          const std::size_t len = packed.decode(b, values);
+          if (b + 1 < packed.blocks()) values[len] = packed.first(b + 1);
+          result = b == begin ? block_fn(b, values, len) : combine(result, block_fn(b, values, len));
+        }
+        return result;
+      },
+      combine);
+}
+
+template <PairTest Test, class Policy, class T>
+std::size_t packed_count_pairs(const PackedView<T>& packed) {
+  if (packed.size() < 2) return 0;
+  return reduce_blocks<Policy>(
+      packed,
+      [&](std::size_t b, const T* values, std::size_t len) {
+        return count_pairs<Test>(values, b + 1 < packed.blocks() ? len : len - 1);
+      },
+      std::plus<std::size_t>());
+}
+
+template <bool IsMax, class Policy, class T>
+std::size_t packed_extremum_index(const PackedView<T>& packed) {
+  return reduce_blocks<Policy>(
+             packed,
+             [](std::size_t b, const T* values, std::size_t len) {
+               auto block = arg_extremum<IsMax>(values, len);
+               block.index += b * kPackBlock;
+               return block;
+             },
+             better_of<IsMax, T>)
+      .index;
+}
+
+}  // namespace detail
+
+// The reductions below decode the blocks on the fly and never materialize
+// the vector; they require a valid, non-empty buffer
+
+template <class Policy = exec::seq, class T, class Acc = accumulator_t<T>>
+Acc packed_sum(const PackedView<T>& packed) {
+  using W = detail::wrap_t<Acc>;
+  return static_cast<Acc>(detail::reduce_blocks<Policy>(
+      packed,
+      [](std::size_t, const T* values, std::size_t len) { return static_cast<W>(sum<T, Acc>(values, len)); },
+      [](W lhs, W rhs) { return static_cast<W>(lhs + rhs); }));
+}
+
+template <class Policy = exec::seq, class T>
+std::size_t packed_min_index(const PackedView<T>& packed) {
+  return detail::packed_extremum_index<false, Policy>(packed);
+}
+
+template <class Policy = exec::seq, class T>
+std::size_t packed_max_index(const PackedView<T>& packed) {
+  return detail::packed_extremum_index<true, Policy>(packed);
+}
+
+template <class Policy = exec::seq, class T>
+std::size_t packed_count_descents(const PackedView<T>& packed) {
+  return detail::packed_count_pairs<detail::PairTest::DESCENT, Policy>(packed);
+}
+
+template <class Policy = exec::seq, class T>
+std::size_t packed_count_sign_changes(const PackedView<T>& packed) {
+  return detail::packed_count_pairs<detail::PairTest::SIGN_CHANGE, Policy>(packed);
+}
+
+}  // namespace ppc::reference::kernels
+
+#endif  // MODULES_REFERENCE_KERNELS_PACKED_HPP_
@@ -0,0 +1,258 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_KERNELS_PARALLEL_HPP_
+#define MODULES_REFERENCE_KERNELS_PARALLEL_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "core/thread_pool/include/thread_pool.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifdef USE_TBB
+#include <oneapi/tbb/parallel_for.h>
+#include <oneapi/tbb/task_arena.h>
+#endif
+
+#ifdef USE_MPI
+#include <mpi.h>
+#endif
+
+namespace ppc::reference::exec {
+
+// Execution policies of the ref kernels
+struct seq {};
+// OpenMP threads, sequential when compiled without OpenMP
+struct omp {};
+// oneTBB tasks, sequential when built without USE_TBB
+struct tbb {};
+// std::threads of the shared ppc::core::ThreadPool
+struct stl {};
+// Processes of MPI_COMM_WORLD. Every rank runs the same task on the same
+// input: reductions split the chunks among the ranks and all-gather the chunk
+// results, so every rank ends up with the full result. chunked_for runs all
+// chunks on every rank. Sequential when built without USE_MPI or when MPI is
+// not initialized.
+struct mpi {};
+// Runs on Policy, but reductions split the input into fixed blocks and fold
+// the block results along a fixed tree, so floating point results are
+// bitwise identical for any backend, thread count and schedule
+template <class Policy>
+struct deterministic {};
+
+namespace detail {
+template <class Policy>
+struct backend {
+  using type = Policy;
+  static constexpr bool deterministic = false;
+};
+template <class Policy>
+struct backend<exec::deterministic<Policy>> {
+  using type = Policy;
+  static constexpr bool deterministic = true;
+};
+template <class Policy>
+using backend_t = typename backend<Policy>::type;
+template <class Policy>
+constexpr bool is_deterministic_v = backend<Policy>::deterministic;
+
+inline std::atomic<std::size_t>& concurrency_override() {
+  static std::atomic<std::size_t> workers{0};
+  return workers;
+}
+
+// Rank of this process and number of ranks, {0, 1} when MPI is not running
+struct MpiWorld {
+  int rank;
+  int size;
+};
+
+inline MpiWorld mpi_world() {
+  MpiWorld world{0, 1};
+#ifdef USE_MPI
+  int initialized = 0;
+  int finalized = 0;
+  MPI_Initialized(&initialized);
+  MPI_Finalized(&finalized);
+  if (initialized != 0 && finalized == 0) {
+    MPI_Comm_rank(MPI_COMM_WORLD, &world.rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &world.size);
+  }
+#endif
+  return world;
+}
+}  // namespace detail
+
+// Overrides the number of workers of the parallel policies (tests use it to
+// split inputs on machines with few cores), 0 restores the backend defaults
+inline void set_concurrency(std::size_t workers) {
+  detail::concurrency_override().store(workers, std::memory_order_relaxed);
+}
+
+template <class Policy>
+std::size_t concurrency() {
+  if constexpr (detail::is_deterministic_v<Policy>) return concurrency<detail::backend_t<Policy>>();
+  if (std::is_same_v<Policy, seq>) return 1;
+  if (auto workers = detail::concurrency_override().load(std::memory_order_relaxed); workers != 0) return workers;
+  std::size_t workers = 1;
+  if constexpr (std::is_same_v<Policy, omp>) {
+#ifdef _OPENMP
+    workers = static_cast<std::size_t>(omp_get_max_threads());
+#endif
+  } else if constexpr (std::is_same_v<Policy, tbb>) {
+#ifdef USE_TBB
+    workers = static_cast<std::size_t>(oneapi::tbb::this_task_arena::max_concurrency());
+#endif
+  } else if constexpr (std::is_same_v<Policy, stl>) {
+    workers = std::thread::hardware_concurrency();
+  } else if constexpr (std::is_same_v<Policy, mpi>) {
+    workers = static_cast<std::size_t>(detail::mpi_world().size);
+  }
+  return std::max<std::size_t>(workers, 1);
+}
+
+// Inputs shorter than this are not split, a chunk has to pay for the thread wake-up
+constexpr std::size_t kMinChunk = std::size_t{1} << 14;
+
+namespace detail {
+
+template <class Policy, class Body>
+void for_each_chunk(std::size_t chunks, const Body& body) {
+  using Backend = backend_t<Policy>;
+  if (chunks == 1) {
+    body(0);
+    return;
+  }
+  if constexpr (std::is_same_v<Backend, omp>) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int c = 0; c < static_cast<int>(chunks); c++) {
+      body(static_cast<std::size_t>(c));
+    }
+  } else if constexpr (std::is_same_v<Backend, tbb>) {
+#ifdef USE_TBB
+    oneapi::tbb::parallel_for(std::size_t{0}, chunks, [&](std::size_t c) { body(c); });
+#else
+    for (std::size_t c = 0; c < chunks; c++) body(c);
+#endif
+  } else if constexpr (std::is_same_v<Backend, stl>) {
+    ppc::core::ThreadPool::instance().parallel_for(chunks, body);
+  } else {
+    for (std::size_t c = 0; c < chunks; c++) body(c);
+  }
+}
+
+// partial[c] = fn(c) for every chunk c. The mpi backend computes a contiguous
+// run of the chunks on every rank and exchanges the results byte-wise; results
+// that are not trivially copyable are computed on every rank instead.
+template <class Policy, class Result, class Fn>
+void compute_partials(std::vector<Result>& partial, const Fn& fn) {
+  const std::size_t chunks = partial.size();
+#ifdef USE_MPI
+  if constexpr (std::is_same_v<backend_t<Policy>, mpi> && std::is_trivially_copyable_v<Result>) {
+    if (const auto world = mpi_world(); world.size > 1) {
+      const auto ranks = static_cast<std::size_t>(world.size);
+      auto first_chunk = [&](std::size_t rank) { return chunks * rank / ranks; };
+      std::vector<int> counts(ranks);
+      std::vector<int> displacements(ranks);
+      for (std::size_t r = 0; r < ranks; r++) {
+        counts[r] = static_cast<int>((first_chunk(r + 1) - first_chunk(r)) * sizeof(Result));
+        displacements[r] = static_cast<int>(first_chunk(r) * sizeof(Result));
+      }
+      const auto rank = static_cast<std::size_t>(world.rank);
+      std::vector<unsigned char> own(static_cast<std::size_t>(counts[rank]));
+      for (std::size_t c = first_chunk(rank); c < first_chunk(rank + 1); c++) {
+        const Result result = fn(c);
+        std::memcpy(own.data() + (c - first_chunk(rank)) * sizeof(Result), &result, sizeof(Result));
+      }
+      std::vector<unsigned char> all(chunks * sizeof(Result));
+      MPI_Allgatherv(own.data(), counts[rank], MPI_BYTE, all.data(), counts.data(), displacements.data(), MPI_BYTE,
+                     MPI_COMM_WORLD);
+      for (std::size_t c = 0; c < chunks; c++) {
+        std::memcpy(&partial[c], all.data() + c * sizeof(Result), sizeof(Result));
+      }
+      return;
+    }
+  }
+#endif
+  // a worker computes a contiguous run of the chunks
+  const std::size_t workers = std::min(chunks, concurrency<Policy>());
+  for_each_chunk<Policy>(workers, [&](std::size_t w) {
+    for (std::size_t c = chunks * w / workers; c < chunks * (w + 1) / workers; c++) partial[c] = fn(c);
+  });
+}
+
+// Folds partial[begin, end) along a balanced tree that depends on the range only
+template <class Result, class Combine>
+Result tree_reduce(const std::vector<Result>& partial, std::size_t begin, std::size_t end, const Combine& combine) {
+  if (end - begin == 1) return partial[begin];
+  const std::size_t mid = begin + (end - begin) / 2;
+  return combine(tree_reduce(partial, begin, mid, combine), tree_reduce(partial, mid, end, combine));
+}
+
+}  // namespace detail
+
+template <class Policy, class Fn>
+void chunked_for(std::size_t n, std::size_t grain, const Fn& fn);
+
+// Splits [0, n) into at most concurrency<Policy>() contiguous chunks of at
+// least grain items (exactly grain items for deterministic policies),
+// evaluates chunk_fn(begin, end) for each of them in parallel and folds the
+// chunk results left to right with combine (along a fixed tree for
+// deterministic policies). The chunks only read the input, so a chunk may look
+// past its end (e.g. at the right neighbour of its last element). An empty
+// range gives chunk_fn(0, 0).
+template <class Policy, class ChunkFn, class Combine>
+auto chunked_reduce(std::size_t n, std::size_t grain, const ChunkFn& chunk_fn, const Combine& combine) {
+  using Result = decltype(chunk_fn(std::size_t{0}, n));
+  if constexpr (detail::is_deterministic_v<Policy>) {
+    // blocks of exactly grain items, the workers only decide who computes them
+    const std::size_t block = std::max<std::size_t>(grain, 1);
+    if (n <= block) return chunk_fn(0, n);
+    const std::size_t blocks = (n + block - 1) / block;
+    std::vector<Result> partial(blocks);
+    detail::compute_partials<Policy>(partial,
+                                     [&](std::size_t b) { return chunk_fn(b * block, std::min(n, (b + 1) * block)); });
+    return detail::tree_reduce(partial, 0, blocks, combine);
+  }
+  const auto chunks = std::clamp<std::size_t>(n / std::max<std::size_t>(grain, 1), 1, concurrency<Policy>());
+  if (chunks == 1) return chunk_fn(0, n);
+
+  std::vector<Result> partial(chunks);
+  detail::compute_partials<Policy>(partial,
+                                   [&](std::size_t c) { return chunk_fn(n * c / chunks, n * (c + 1) / chunks); });
+
+  Result result = partial[0];
+  for (std::size_t c = 1; c < chunks; c++) {
+    result = combine(result, partial[c]);
+  }
+  return result;
+}
+
+// chunked_reduce over chunks of at least kMinChunk elements
+template <class Policy, class ChunkFn, class Combine>
+auto chunked_reduce(std::size_t n, const ChunkFn& chunk_fn, const Combine& combine) {
+  return chunked_reduce<Policy>(n, kMinChunk, chunk_fn, combine);
+}
+
+// Runs fn(begin, end) in parallel over the same chunks as chunked_reduce,
+// for bodies that write disjoint parts of the output
+template <class Policy, class Fn>
+void chunked_for(std::size_t n, std::size_t grain, const Fn& fn) {
+  if (n == 0) return;
+  const auto chunks = std::clamp<std::size_t>(n / std::max<std::size_t>(grain, 1), 1, concurrency<Policy>());
+  detail::for_each_chunk<Policy>(chunks, [&](std::size_t c) { fn(n * c / chunks, n * (c + 1) / chunks); });
+}
+
+}  // namespace ppc::reference::exec
+
+#endif  // MODULES_REFERENCE_KERNELS_PARALLEL_HPP_
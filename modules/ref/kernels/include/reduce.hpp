@@ -0,0 +1,443 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_KERNELS_REDUCE_HPP_
+#define MODULES_REFERENCE_KERNELS_REDUCE_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "ref/kernels/include/accumulator.hpp"
+#include "ref/kernels/include/half.hpp"
+#include "ref/kernels/include/isa.hpp"
+#include "ref/kernels/include/parallel.hpp"
+
+#ifdef PPC_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace ppc::reference::kernels {
+
+// A value together with its position in the input
+template <class T>
+struct Extremum {
+  T value;
+  std::size_t index;
+};
+
+namespace detail {
+
+template <class T>
+bool is_nan(const T& x) {
+  if constexpr (std::is_floating_point_v<compute_t<T>>) {
+    return std::isnan(static_cast<compute_t<T>>(x));
+  } else {
+    return false;
+  }
+}
+
+template <bool IsMax, class T>
+bool better(T candidate, T current) {
+  return IsMax ? current < candidate : candidate < current;
+}
+
+// Extremum over the candidates: a NaN loses to any number and the lower index
+// wins on ties, so the result does not depend on the order of the merges
+template <bool IsMax, class T>
+Extremum<T> better_of(const Extremum<T>& current, const Extremum<T>& candidate) {
+  const bool current_nan = is_nan(current.value);
+  if (current_nan != is_nan(candidate.value)) return current_nan ? candidate : current;
+  if (better<IsMax>(candidate.value, current.value) ||
+      ((current_nan || candidate.value == current.value) && candidate.index < current.index)) {
+    return candidate;
+  }
+  return current;
+}
+
+// The value every number beats or ties with
+template <bool IsMax, class T>
+T worst_value() {
+  using limits = std::numeric_limits<T>;
+  if constexpr (limits::has_infinity) return IsMax ? -limits::infinity() : limits::infinity();
+  return IsMax ? limits::lowest() : limits::max();
+}
+
+// Integers are accumulated in the unsigned type of the same width, so
+// overflow wraps exactly like the scalar code does after narrowing
+template <class T, class = void>
+struct wrap {
+  using type = T;
+};
+template <class T>
+struct wrap<T, std::enable_if_t<std::is_integral_v<T>>> {
+  using type = std::make_unsigned_t<T>;
+};
+template <class T>
+using wrap_t = typename wrap<T>::type;
+
+// Independent accumulators per kernel, enough to hide the add latency
+constexpr std::size_t kAccumulators = 4;
+
+template <class Acc, class T>
+Acc sum_scalar(const T* data, std::size_t n) {
+  using W = wrap_t<Acc>;
+  W acc[kAccumulators] = {};
+  std::size_t i = 0;
+  for (; i + kAccumulators <= n; i += kAccumulators) {
+    for (std::size_t k = 0; k < kAccumulators; k++) {
+      acc[k] += static_cast<W>(data[i + k]);
+    }
+  }
+  for (; i < n; i++) {
+    acc[0] += static_cast<W>(data[i]);
+  }
+  W total = 0;
+  for (auto a : acc) {
+    total += a;
+  }
+  return static_cast<Acc>(total);
+}
+
+#ifdef PPC_SIMD_X86
+
+// Vector kernels never pass vectors across a call boundary: they are always
+// inlined into the per-ISA entry points below and only exchange scalars.
+
+// out = the next lanes of V elements of data converted to the lane type of V,
+// Bytes is the register width of the calling kernel
+template <std::size_t Bytes, class V, class T>
+PPC_SIMD_INLINE void load_widened(const T* data, V& out) {
+  using Lane = std::remove_cvref_t<decltype(out[0])>;
+  constexpr std::size_t lanes = sizeof(V) / sizeof(Lane);
+  if constexpr (is_half_v<T>) {
+    vec_t<float, lanes * sizeof(float)> wide;
+    widen_half<Bytes>(data, wide);
+    out = __builtin_convertvector(wide, V);
+  } else {
+    vec_t<T, lanes * sizeof(T)> v;
+    std::memcpy(&v, data, sizeof(v));
+    out = __builtin_convertvector(v, V);
+  }
+}
+
+template <std::size_t Bytes, class Acc, class T>
+PPC_SIMD_INLINE Acc sum_vec(const T* data, std::size_t n) {
+  using W = wrap_t<Acc>;
+  constexpr std::size_t lanes = Bytes / sizeof(W);
+  using AccVec = vec_t<W, Bytes>;
+
+  AccVec acc[kAccumulators] = {};
+  std::size_t i = 0;
+  for (; i + kAccumulators * lanes <= n; i += kAccumulators * lanes) {
+    for (std::size_t k = 0; k < kAccumulators; k++) {
+      AccVec v;
+      load_widened<Bytes>(data + i + k * lanes, v);
+      acc[k] += v;
+    }
+  }
+  acc[0] = (acc[0] + acc[1]) + (acc[2] + acc[3]);
+
+  W total = 0;
+  for (std::size_t l = 0; l < lanes; l++) {
+    total += acc[0][l];
+  }
+  for (; i < n; i++) {
+    total += static_cast<W>(data[i]);
+  }
+  return static_cast<Acc>(total);
+}
+
+// Smallest (largest) element that is not NaN, worst_value when there is none
+template <std::size_t Bytes, bool IsMax, class T>
+PPC_SIMD_INLINE T extremum_vec(const T* data, std::size_t n) {
+  constexpr std::size_t lanes = Bytes / sizeof(T);
+  using V = vec_t<T, Bytes>;
+
+  // a NaN never compares better, so lanes seeded with a number skip them
+  V acc[kAccumulators];
+  for (auto& a : acc) {
+    for (std::size_t l = 0; l < lanes; l++) a[l] = worst_value<IsMax, T>();
+  }
+  std::size_t i = 0;
+  for (; i + kAccumulators * lanes <= n; i += kAccumulators * lanes) {
+    for (std::size_t k = 0; k < kAccumulators; k++) {
+      V v;
+      std::memcpy(&v, data + i + k * lanes, sizeof(v));
+      if constexpr (IsMax) {
+        acc[k] = v > acc[k] ? v : acc[k];
+      } else {
+        acc[k] = v < acc[k] ? v : acc[k];
+      }
+    }
+  }
+
+  T result = worst_value<IsMax, T>();
+  for (const auto& a : acc) {
+    for (std::size_t l = 0; l < lanes; l++) {
+      if (better<IsMax>(static_cast<T>(a[l]), result)) result = a[l];
+    }
+  }
+  for (; i < n; i++) {
+    if (better<IsMax>(data[i], result)) result = data[i];
+  }
+  return result;
+}
+
+// index of the first element equal to value, n if there is none
+template <std::size_t Bytes, class T>
+PPC_SIMD_INLINE std::size_t find_vec(const T* data, std::size_t n, T value) {
+  constexpr std::size_t lanes = Bytes / sizeof(T);
+  using V = vec_t<T, Bytes>;
+
+  V target;
+  for (std::size_t l = 0; l < lanes; l++) target[l] = value;
+  std::size_t i = 0;
+  for (; i + lanes <= n; i += lanes) {
+    V v;
+    std::memcpy(&v, data + i, sizeof(v));
+    auto eq = v == target;
+    uint64_t words[Bytes / sizeof(uint64_t)];
+    std::memcpy(words, &eq, sizeof(words));
+    uint64_t any = 0;
+    for (auto w : words) any |= w;
+    if (any != 0) break;
+  }
+  for (; i < n; i++) {
+    if (data[i] == value) return i;
+  }
+  return n;
+}
+
+template <class Acc, class T>
+Acc sum_sse2(const T* data, std::size_t n) {
+  return sum_vec<16, Acc>(data, n);
+}
+template <class Acc, class T>
+PPC_SIMD_TARGET_AVX2 Acc sum_avx2(const T* data, std::size_t n) {
+  return sum_vec<32, Acc>(data, n);
+}
+template <class Acc, class T>
+PPC_SIMD_TARGET_AVX512 Acc sum_avx512(const T* data, std::size_t n) {
+  return sum_vec<64, Acc>(data, n);
+}
+
+template <bool IsMax, class T>
+std::size_t extremum_index_sse2(const T* data, std::size_t n) {
+  return find_vec<16>(data, n, extremum_vec<16, IsMax>(data, n));
+}
+template <bool IsMax, class T>
+PPC_SIMD_TARGET_AVX2 std::size_t extremum_index_avx2(const T* data, std::size_t n) {
+  return find_vec<32>(data, n, extremum_vec<32, IsMax>(data, n));
+}
+template <bool IsMax, class T>
+PPC_SIMD_TARGET_AVX512 std::size_t extremum_index_avx512(const T* data, std::size_t n) {
+  return find_vec<64>(data, n, extremum_vec<64, IsMax>(data, n));
+}
+
+// Exact sums of bytes: psadbw adds eight bytes into a 64-bit lane at a time,
+// so the byte stream is widened without ever overflowing. Each byte is XORed
+// with bias first, 0x80 maps int8 onto uint8 shifted by 128.
+PPC_SIMD_TARGET("sse2") inline uint64_t byte_sum_sse2(const uint8_t* data, std::size_t n, uint8_t bias) {
+  const __m128i flip = _mm_set1_epi8(static_cast<char>(bias));
+  const __m128i zero = _mm_setzero_si128();
+  __m128i acc0 = zero;
+  __m128i acc1 = zero;
+  std::size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 16));
+    acc0 = _mm_add_epi64(acc0, _mm_sad_epu8(_mm_xor_si128(a, flip), zero));
+    acc1 = _mm_add_epi64(acc1, _mm_sad_epu8(_mm_xor_si128(b, flip), zero));
+  }
+  uint64_t lanes[2];
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), _mm_add_epi64(acc0, acc1));
+  uint64_t total = lanes[0] + lanes[1];
+  for (; i < n; i++) total += static_cast<uint8_t>(data[i] ^ bias);
+  return total;
+}
+
+PPC_SIMD_TARGET_AVX2 inline uint64_t byte_sum_avx2(const uint8_t* data, std::size_t n, uint8_t bias) {
+  const __m256i flip = _mm256_set1_epi8(static_cast<char>(bias));
+  const __m256i zero = _mm256_setzero_si256();
+  __m256i acc0 = zero;
+  __m256i acc1 = zero;
+  std::size_t i = 0;
+  for (; i + 64 <= n; i += 64) {
+    const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+    const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 32));
+    acc0 = _mm256_add_epi64(acc0, _mm256_sad_epu8(_mm256_xor_si256(a, flip), zero));
+    acc1 = _mm256_add_epi64(acc1, _mm256_sad_epu8(_mm256_xor_si256(b, flip), zero));
+  }
+  uint64_t lanes[4];
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi64(acc0, acc1));
+  uint64_t total = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+  for (; i < n; i++) total += static_cast<uint8_t>(data[i] ^ bias);
+  return total;
+}
+
+PPC_SIMD_TARGET_AVX512 inline uint64_t byte_sum_avx512(const uint8_t* data, std::size_t n, uint8_t bias) {
+  const __m512i flip = _mm512_set1_epi8(static_cast<char>(bias));
+  const __m512i zero = _mm512_setzero_si512();
+  __m512i acc0 = zero;
+  __m512i acc1 = zero;
+  std::size_t i = 0;
+  for (; i + 128 <= n; i += 128) {
+    const __m512i a = _mm512_loadu_si512(data + i);
+    const __m512i b = _mm512_loadu_si512(data + i + 64);
+    acc0 = _mm512_add_epi64(acc0, _mm512_sad_epu8(_mm512_xor_si512(a, flip), zero));
+    acc1 = _mm512_add_epi64(acc1, _mm512_sad_epu8(_mm512_xor_si512(b, flip), zero));
+  }
+  uint64_t lanes[8];
+  _mm512_storeu_si512(lanes, _mm512_add_epi64(acc0, acc1));
+  uint64_t total = ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+  for (; i < n; i++) total += static_cast<uint8_t>(data[i] ^ bias);
+  return total;
+}
+
+#endif  // PPC_SIMD_X86
+
+// First smallest (largest) element that is not NaN, {data[0], 0} when all are
+// NaN; requires n > 0
+template <bool IsMax, class T>
+Extremum<T> arg_extremum(const T* data, std::size_t n) {
+#ifdef PPC_SIMD_X86
+  std::size_t index = n;
+  switch (active_isa()) {
+    case Isa::AVX512:
+      index = extremum_index_avx512<IsMax>(data, n);
+      break;
+    case Isa::AVX2:
+      index = extremum_index_avx2<IsMax>(data, n);
+      break;
+    case Isa::SSE2:
+      index = extremum_index_sse2<IsMax>(data, n);
+      break;
+    default:
+      break;
+  }
+  // the vector search finds an element unless every one is NaN
+  if (index < n) return {data[index], index};
+#endif
+  Extremum<T> best{data[0], 0};
+  for (std::size_t i = 1; i < n; i++) {
+    if (!is_nan(data[i]) && (is_nan(best.value) || better<IsMax>(data[i], best.value))) best = {data[i], i};
+  }
+  return best;
+}
+
+// Extremum over the chunks of a parallel policy. A NaN at the front wins, as
+// it does in std::min_element; later NaNs are skipped, so the chunks can be
+// searched independently and merged with better_of in any grouping.
+template <bool IsMax, class Policy, class T>
+Extremum<T> parallel_arg_extremum(const T* data, std::size_t n) {
+  if (is_nan(data[0])) return {data[0], 0};
+  return exec::chunked_reduce<Policy>(
+      n,
+      [&](std::size_t begin, std::size_t end) {
+        auto chunk = arg_extremum<IsMax>(data + begin, end - begin);
+        chunk.index += begin;
+        return chunk;
+      },
+      better_of<IsMax, T>);
+}
+
+// Exact sum of n 8-bit integers
+template <class T>
+std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t> byte_sum(const T* data, std::size_t n) {
+  const auto* bytes = reinterpret_cast<const uint8_t*>(data);
+  const uint8_t bias = std::is_signed_v<T> ? 0x80 : 0;
+  uint64_t total = 0;
+  switch (active_isa()) {
+#ifdef PPC_SIMD_X86
+    case Isa::AVX512:
+      total = byte_sum_avx512(bytes, n, bias);
+      break;
+    case Isa::AVX2:
+      total = byte_sum_avx2(bytes, n, bias);
+      break;
+    case Isa::SSE2:
+      total = byte_sum_sse2(bytes, n, bias);
+      break;
+#endif
+    default:
+      for (std::size_t i = 0; i < n; i++) total += static_cast<uint8_t>(bytes[i] ^ bias);
+      break;
+  }
+  if constexpr (std::is_signed_v<T>) {
+    return static_cast<int64_t>(total) - static_cast<int64_t>(n) * 0x80;
+  } else {
+    return total;
+  }
+}
+
+}  // namespace detail
+
+// Sum of n elements accumulated in Acc. Integer sums wrap modulo 2^bits of
+// Acc, floating point sums use several partial sums (the summation order
+// differs from a left-to-right loop). Pass Acc = accumulator_t<T> for a sum
+// that does not overflow; bytes are then widened with psadbw. half and
+// bfloat16 elements are widened to float in registers.
+template <class T, class Acc = compute_t<T>>
+Acc sum(const T* data, std::size_t n) {
+  if constexpr (std::is_integral_v<T> && sizeof(T) == 1 && sizeof(Acc) > 1) {
+    return static_cast<Acc>(detail::byte_sum(data, n));
+  }
+#ifdef PPC_SIMD_X86
+  switch (active_isa()) {
+    case Isa::AVX512:
+      return detail::sum_avx512<Acc>(data, n);
+    case Isa::AVX2:
+      return detail::sum_avx2<Acc>(data, n);
+    case Isa::SSE2:
+      return detail::sum_sse2<Acc>(data, n);
+    default:
+      break;
+  }
+#endif
+  return detail::sum_scalar<Acc>(data, n);
+}
+
+// sum<T, Acc> over the chunks of a parallel policy; pass an
+// exec::deterministic policy for results independent of the thread count
+template <class Policy, class T, class Acc = compute_t<T>>
+Acc parallel_sum(const T* data, std::size_t n) {
+  using W = detail::wrap_t<Acc>;
+  if (n == 0) return Acc{0};
+  return static_cast<Acc>(exec::chunked_reduce<Policy>(
+      n, [&](std::size_t begin, std::size_t end) { return static_cast<W>(sum<T, Acc>(data + begin, end - begin)); },
+      [](W lhs, W rhs) { return static_cast<W>(lhs + rhs); }));
+}
+
+// The first smallest element and its index, the same as std::min_element
+// gives for every policy, thread count and instruction set; requires n > 0
+template <class Policy = exec::seq, class T>
+Extremum<T> argmin(const T* data, std::size_t n) {
+  return detail::parallel_arg_extremum<false, Policy>(data, n);
+}
+
+// The first largest element and its index, the same as std::max_element
+// gives for every policy, thread count and instruction set; requires n > 0
+template <class Policy = exec::seq, class T>
+Extremum<T> argmax(const T* data, std::size_t n) {
+  return detail::parallel_arg_extremum<true, Policy>(data, n);
+}
+
+// Index of the first smallest element, same result as std::min_element
+template <class T>
+std::size_t min_index(const T* data, std::size_t n) {
+  return n == 0 ? 0 : argmin(data, n).index;
+}
+
+// Index of the first largest element, same result as std::max_element
+template <class T>
+std::size_t max_index(const T* data, std::size_t n) {
+  return n == 0 ? 0 : argmax(data, n).index;
+}
+
+}  // namespace ppc::reference::kernels
+
+#endif  // MODULES_REFERENCE_KERNELS_REDUCE_HPP_
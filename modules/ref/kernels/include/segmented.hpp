@@ -0,0 +1,93 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_KERNELS_SEGMENTED_HPP_
+#define MODULES_REFERENCE_KERNELS_SEGMENTED_HPP_
+
+#include <algorithm>
+#include <cstddef>
+
+#include "ref/kernels/include/dot.hpp"
+#include "ref/kernels/include/neighbors.hpp"
+#include "ref/kernels/include/parallel.hpp"
+#include "ref/kernels/include/reduce.hpp"
+
+namespace ppc::reference::kernels {
+
+// Segment s of a CSR-style layout is [offsets[s], offsets[s + 1]) of the
+// values buffer, offsets holds segments + 1 nondecreasing entries.
+//
+// Calls fn(s, begin, end) for every segment. The workers get contiguous runs
+// of segments holding about the same number of elements, so thousands of short
+// segments spread evenly. A segment too long to share a worker with others is
+// handed to large_fn(s, begin, end) instead, which runs one such segment at a
+// time and is expected to split it across the workers itself.
+template <class Policy, class Offset, class Fn, class LargeFn>
+void for_each_segment(const Offset* offsets, std::size_t segments, const Fn& fn, const LargeFn& large_fn) {
+  if (segments == 0) return;
+  const auto first = static_cast<std::size_t>(offsets[0]);
+  const auto total = static_cast<std::size_t>(offsets[segments]) - first;
+  const std::size_t workers = exec::concurrency<Policy>();
+  const std::size_t large = workers == 1 ? total + 1 : std::max(2 * exec::kMinChunk, total / workers);
+  auto is_large = [&](std::size_t s) { return static_cast<std::size_t>(offsets[s + 1] - offsets[s]) >= large; };
+
+  // a worker owns the segments starting inside its share of the elements
+  auto segment_at = [&](std::size_t element) {
+    return static_cast<std::size_t>(std::lower_bound(offsets, offsets + segments, static_cast<Offset>(first + element)) -
+                                    offsets);
+  };
+  exec::chunked_for<Policy>(std::max<std::size_t>(total, 1), exec::kMinChunk, [&](std::size_t begin, std::size_t end) {
+    const std::size_t last = end >= total ? segments : segment_at(end);
+    for (std::size_t s = segment_at(begin); s < last; s++) {
+      if (!is_large(s)) fn(s, static_cast<std::size_t>(offsets[s]), static_cast<std::size_t>(offsets[s + 1]));
+    }
+  });
+  for (std::size_t s = 0; s < segments; s++) {
+    if (is_large(s)) large_fn(s, static_cast<std::size_t>(offsets[s]), static_cast<std::size_t>(offsets[s + 1]));
+  }
+}
+
+// out[s] = sum of segment s accumulated in Acc, 0 for empty segments
+template <class Policy = exec::seq, class T, class Offset, class Acc>
+void segmented_sum(const T* data, const Offset* offsets, std::size_t segments, Acc* out) {
+  for_each_segment<Policy>(
+      offsets, segments,
+      [&](std::size_t s, std::size_t begin, std::size_t end) { out[s] = sum<T, Acc>(data + begin, end - begin); },
+      [&](std::size_t s, std::size_t begin, std::size_t end) {
+        out[s] = parallel_sum<Policy, T, Acc>(data + begin, end - begin);
+      });
+}
+
+// out[s] = dot product of segment s of x and y, 0 for empty segments
+template <class Policy = exec::seq, class T, class Offset>
+void segmented_dot(const T* x, const T* y, const Offset* offsets, std::size_t segments, T* out) {
+  for_each_segment<Policy>(
+      offsets, segments,
+      [&](std::size_t s, std::size_t begin, std::size_t end) {
+        out[s] = dot(x + begin, y + begin, end - begin);
+      },
+      [&](std::size_t s, std::size_t begin, std::size_t end) {
+        out[s] = dot<Precision::FAST, Policy>(x + begin, y + begin, end - begin);
+      });
+}
+
+// value[s] and index[s] (relative to the segment start) of the first smallest
+// (IsMax = false) or largest element of every segment, which must not be empty
+template <bool IsMax, class Policy = exec::seq, class T, class Offset, class Index>
+void segmented_extremum(const T* data, const Offset* offsets, std::size_t segments, T* value, Index* index) {
+  auto store = [&](std::size_t s, std::size_t begin, std::size_t i) {
+    value[s] = data[begin + i];
+    index[s] = static_cast<Index>(i);
+  };
+  for_each_segment<Policy>(
+      offsets, segments,
+      [&](std::size_t s, std::size_t begin, std::size_t end) {
+        store(s, begin, IsMax ? max_index(data + begin, end - begin) : min_index(data + begin, end - begin));
+      },
+      [&](std::size_t s, std::size_t begin, std::size_t end) {
+        store(s, begin, detail::parallel_arg_extremum<IsMax, Policy>(data + begin, end - begin).index);
+      });
+}
+
+}  // namespace ppc::reference::kernels
+
+#endif  // MODULES_REFERENCE_KERNELS_SEGMENTED_HPP_
@@ -0,0 +1,241 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_KERNELS_STATISTICS_HPP_
+#define MODULES_REFERENCE_KERNELS_STATISTICS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "ref/kernels/include/accumulator.hpp"
+#include "ref/kernels/include/count.hpp"
+#include "ref/kernels/include/isa.hpp"
+#include "ref/kernels/include/neighbors.hpp"
+#include "ref/kernels/include/parallel.hpp"
+#include "ref/kernels/include/reduce.hpp"
+
+namespace ppc::reference::kernels {
+
+// Everything one scan over a vector yields
+template <class T>
+struct Statistics {
+  std::size_t count;
+  // exact for integers (wraps only past 64 bits), double for floating point
+  accumulator_t<T> sum;
+  double mean;
+  // sum of squared deviations from the mean
+  double m2;
+  Extremum<T> min;
+  Extremum<T> max;
+  // adjacent pairs with strictly opposite signs
+  std::size_t sign_changes;
+
+  // population variance
+  double variance() const { return count == 0 ? 0.0 : m2 / static_cast<double>(count); }
+};
+
+namespace detail {
+
+// Raw moments of one chunk, taken around the shift (the first element of the
+// chunk) so that sum of squares does not cancel catastrophically
+template <class T>
+struct Moments {
+  std::size_t count;
+  wrap_t<accumulator_t<T>> sum;
+  double shift;
+  double shifted_sum;
+  double shifted_squares;
+  Extremum<T> min;
+  Extremum<T> max;
+  std::size_t sign_changes;
+};
+
+template <class T>
+Statistics<T> finish(const Moments<T>& m) {
+  const auto n = static_cast<double>(m.count);
+  const double mean = m.shift + m.shifted_sum / n;
+  double m2 = m.shifted_squares - m.shifted_sum * m.shifted_sum / n;
+  if (m2 < 0) m2 = 0;
+  return {m.count, static_cast<accumulator_t<T>>(m.sum), mean, m2, m.min, m.max, m.sign_changes};
+}
+
+// Chan et al. pairwise update of the mean and the squared deviations
+template <class T>
+Statistics<T> merge(const Statistics<T>& a, const Statistics<T>& b) {
+  const std::size_t count = a.count + b.count;
+  const double delta = b.mean - a.mean;
+  const double weight = static_cast<double>(b.count) / static_cast<double>(count);
+  Statistics<T> result;
+  result.count = count;
+  result.sum = static_cast<accumulator_t<T>>(static_cast<wrap_t<accumulator_t<T>>>(a.sum) +
+                                             static_cast<wrap_t<accumulator_t<T>>>(b.sum));
+  result.mean = a.mean + delta * weight;
+  result.m2 = a.m2 + b.m2 + delta * delta * static_cast<double>(a.count) * weight;
+  result.min = better_of<false>(a.min, b.min);
+  result.max = better_of<true>(a.max, b.max);
+  result.sign_changes = a.sign_changes + b.sign_changes;
+  return result;
+}
+
+// Elements [i, len) of a chunk and the pairs [i, pairs)
+template <class T>
+void moments_scalar(const T* data, std::size_t i, std::size_t len, std::size_t pairs, Moments<T>& m) {
+  using A = wrap_t<accumulator_t<T>>;
+  for (; i < len; i++) {
+    const T x = data[i];
+    const double d = static_cast<double>(x) - m.shift;
+    m.sum += static_cast<A>(x);
+    m.shifted_sum += d;
+    m.shifted_squares += d * d;
+    // NaNs are skipped, a NaN seed gives way to the first number
+    if (!is_nan(x)) {
+      if (is_nan(m.min.value) || better<false>(x, m.min.value)) m.min = {x, i};
+      if (is_nan(m.max.value) || better<true>(x, m.max.value)) m.max = {x, i};
+    }
+    if (i < pairs && pair_test<PairTest::SIGN_CHANGE>(x, data[i + 1])) m.sign_changes++;
+  }
+}
+
+#ifdef PPC_SIMD_X86
+
+// All statistics in one pass: the moments are accumulated in double lanes,
+// so every vector holds Bytes / 8 elements; min and max keep a value and the
+// iteration it was seen at per lane, like the neighbor kernels. A lane takes
+// its first number unconditionally and skips NaNs, so lanes that saw only
+// NaNs are left out of the result.
+template <std::size_t Bytes, class T>
+PPC_SIMD_INLINE void moments_vec(const T* data, std::size_t pairs, std::size_t& i, Moments<T>& m) {
+  using A = wrap_t<accumulator_t<T>>;
+  constexpr std::size_t lanes = Bytes / sizeof(double);
+  using TV = vec_t<T, lanes * sizeof(T)>;
+  using DV = vec_t<double, Bytes>;
+  using AV = vec_t<A, Bytes>;
+  using IV = vec_t<int64_t, Bytes>;
+  if (pairs < lanes) return;
+
+  DV shift;
+  IV ones;
+  for (std::size_t l = 0; l < lanes; l++) {
+    shift[l] = m.shift;
+    ones[l] = 1;
+  }
+  const TV zero = {};
+  AV sum = {};
+  DV s1 = {};
+  DV s2 = {};
+  IV changes = {};
+  IV iteration = {};
+  IV min_iteration = {};
+  IV max_iteration = {};
+  TV min = {};
+  TV max = {};
+  using MV = decltype(min < max);
+  MV seen = {};
+
+  const std::size_t start = i;
+  for (; i + lanes <= pairs; i += lanes) {
+    TV x, y;
+    std::memcpy(&x, data + i, sizeof(x));
+    std::memcpy(&y, data + i + 1, sizeof(y));
+    sum += __builtin_convertvector(x, AV);
+    const DV d = __builtin_convertvector(x, DV) - shift;
+    s1 += d;
+    s2 += d * d;
+
+    const MV number = x == x;
+    const MV first = number & ~seen;
+    seen |= number;
+    const MV below = (x < min) | first;
+    const MV above = (x > max) | first;
+    min = below ? x : min;
+    max = above ? x : max;
+    min_iteration = __builtin_convertvector(below, IV) ? iteration : min_iteration;
+    max_iteration = __builtin_convertvector(above, IV) ? iteration : max_iteration;
+    iteration += ones;
+
+    if constexpr (std::is_integral_v<T>) {
+      changes -= __builtin_convertvector(((x ^ y) < zero) & (x != zero) & (y != zero), IV);
+    } else {
+      changes -= __builtin_convertvector(((x < zero) & (y > zero)) | ((x > zero) & (y < zero)), IV);
+    }
+  }
+
+  for (std::size_t l = 0; l < lanes; l++) {
+    m.sum += sum[l];
+    m.shifted_sum += s1[l];
+    m.shifted_squares += s2[l];
+    m.sign_changes += static_cast<std::size_t>(changes[l]);
+    if (seen[l] == 0) continue;
+    const std::size_t base = start + l;
+    m.min = better_of<false>(m.min, Extremum<T>{min[l], base + static_cast<std::size_t>(min_iteration[l]) * lanes});
+    m.max = better_of<true>(m.max, Extremum<T>{max[l], base + static_cast<std::size_t>(max_iteration[l]) * lanes});
+  }
+}
+
+template <class T>
+void moments_sse2(const T* data, std::size_t pairs, std::size_t& i, Moments<T>& m) {
+  moments_vec<16>(data, pairs, i, m);
+}
+template <class T>
+PPC_SIMD_TARGET_AVX2 void moments_avx2(const T* data, std::size_t pairs, std::size_t& i, Moments<T>& m) {
+  moments_vec<32>(data, pairs, i, m);
+}
+template <class T>
+PPC_SIMD_TARGET_AVX512 void moments_avx512(const T* data, std::size_t pairs, std::size_t& i, Moments<T>& m) {
+  moments_vec<64>(data, pairs, i, m);
+}
+
+#endif  // PPC_SIMD_X86
+
+// Statistics of data[0, len), the pair (len - 1, len) is included when has_next
+template <class T>
+Statistics<T> statistics_chunk(const T* data, std::size_t len, bool has_next) {
+  Moments<T> m{0, 0, static_cast<double>(data[0]), 0.0, 0.0, {data[0], 0}, {data[0], 0}, 0};
+  m.count = len;
+  const std::size_t pairs = has_next ? len : len - 1;
+  std::size_t i = 0;
+#ifdef PPC_SIMD_X86
+  switch (active_isa()) {
+    case Isa::AVX512:
+      moments_avx512(data, pairs, i, m);
+      break;
+    case Isa::AVX2:
+      moments_avx2(data, pairs, i, m);
+      break;
+    case Isa::SSE2:
+      moments_sse2(data, pairs, i, m);
+      break;
+    default:
+      break;
+  }
+#endif
+  moments_scalar(data, i, len, pairs, m);
+  return finish(m);
+}
+
+}  // namespace detail
+
+// Count, sum, mean, variance, first min and max with their indices and the
+// number of sign alternations of n > 0 elements, all in a single pass. NaNs
+// are skipped by min and max unless they come first, the same as argmin and
+// argmax do.
+template <class Policy = exec::seq, class T>
+Statistics<T> statistics(const T* data, std::size_t n) {
+  auto result = exec::chunked_reduce<Policy>(
+      n,
+      [&](std::size_t begin, std::size_t end) {
+        auto chunk = detail::statistics_chunk(data + begin, end - begin, end < n);
+        chunk.min.index += begin;
+        chunk.max.index += begin;
+        return chunk;
+      },
+      detail::merge<T>);
+  // the chunks skip every NaN, so they merge the same in any grouping
+  if (detail::is_nan(data[0])) result.min = result.max = {data[0], 0};
+  return result;
+}
+
+}  // namespace ppc::reference::kernels
+
+#endif  // MODULES_REFERENCE_KERNELS_STATISTICS_HPP_
@@ -0,0 +1,342 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_KERNELS_TRANSFORM_REDUCE_HPP_
+#define MODULES_REFERENCE_KERNELS_TRANSFORM_REDUCE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "ref/kernels/include/accumulator.hpp"
+#include "ref/kernels/include/half.hpp"
+#include "ref/kernels/include/isa.hpp"
+#include "ref/kernels/include/parallel.hpp"
+#include "ref/kernels/include/reduce.hpp"
+
+namespace ppc::reference::kernels {
+
+// transform_reduce<Op> folds Op::transform of every element, or of every
+// adjacent pair (data[i], data[i + 1]) for pairwise operators, with
+// Op::combine. An operator provides
+//
+//   argument_type   the elements are converted to it before the transform
+//   value_type      result of the transform and of combine
+//   result_type     result of finish
+//   pairwise        transform takes two neighbouring elements
+//   associative     combine may be regrouped, so the input is split among the
+//                   workers and into SIMD lanes; otherwise it is folded left
+//                   to right on one worker
+//   identity()      neutral element of combine
+//   transform(x, out) or transform(x, y, out) and combine(acc, value), which
+//                   adds value to acc in place; templates accepting scalars
+//                   and GCC vectors alike
+//   finish(value)
+//
+// Associative operators with arithmetic argument and value types of the same
+// size get vector kernels for free: a register of arguments maps lane by lane
+// onto a register of values. Vectors are passed by reference only, so an
+// operator never passes one across a call with a different ABI.
+
+namespace detail {
+
+// out = 1 where the comparison result mask holds, 0 elsewhere
+template <class M, class R>
+PPC_SIMD_INLINE void indicator(const M& mask, R& out) {
+#ifdef PPC_SIMD_X86
+  if constexpr (!std::is_arithmetic_v<M>) {
+    out = -__builtin_convertvector(mask, R);
+  } else {
+    out = static_cast<R>(mask != 0);
+  }
+#else
+  out = static_cast<R>(mask != 0);
+#endif
+}
+
+// Lane type the comparisons of T elements run in: 64 bits of the same kind
+template <class T>
+using lane_t = std::conditional_t<std::is_floating_point_v<compute_t<T>>, double,
+                                  std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>>;
+
+template <class Op, class A = typename Op::argument_type, class V = typename Op::value_type>
+constexpr bool vectorizable_v =
+    Op::associative && std::is_arithmetic_v<A> && std::is_arithmetic_v<V> && sizeof(A) == sizeof(V);
+
+template <class Op>
+struct is_fused : std::false_type {};
+
+}  // namespace detail
+
+namespace ops {
+
+// Sum accumulated in Acc; integer sums wrap modulo 2^bits of Acc
+template <class T, class Acc = accumulator_t<T>>
+struct Sum {
+  using argument_type = detail::wrap_t<Acc>;
+  using value_type = detail::wrap_t<Acc>;
+  using result_type = Acc;
+  static constexpr bool pairwise = false;
+  static constexpr bool associative = true;
+  static value_type identity() { return 0; }
+  template <class X>
+  static PPC_SIMD_INLINE void transform(const X& x, X& out) {
+    out = x;
+  }
+  template <class X>
+  static PPC_SIMD_INLINE void combine(X& acc, const X& value) {
+    acc += value;
+  }
+  static result_type finish(value_type value) { return static_cast<result_type>(value); }
+};
+
+// Sum of squares accumulated in Acc
+template <class T, class Acc = accumulator_t<T>>
+struct SumOfSquares : Sum<T, Acc> {
+  template <class X>
+  static PPC_SIMD_INLINE void transform(const X& x, X& out) {
+    out = x * x;
+  }
+};
+
+// Smallest (IsMax = false) or largest element. A fold knows no positions, so
+// NaNs are skipped wherever they are and an input of NaNs only gives
+// identity(); kernels::argmin / argmax and the Min and Max tasks return a NaN
+// in front instead.
+template <bool IsMax, class T>
+struct Extreme {
+  using argument_type = compute_t<T>;
+  using value_type = compute_t<T>;
+  using result_type = compute_t<T>;
+  static constexpr bool pairwise = false;
+  static constexpr bool associative = true;
+  static value_type identity() {
+    using limits = std::numeric_limits<value_type>;
+    if constexpr (limits::has_infinity) return IsMax ? -limits::infinity() : limits::infinity();
+    return IsMax ? limits::lowest() : limits::max();
+  }
+  template <class X>
+  static PPC_SIMD_INLINE void transform(const X& x, X& out) {
+    out = x;
+  }
+  template <class X>
+  static PPC_SIMD_INLINE void combine(X& acc, const X& value) {
+    if constexpr (IsMax) {
+      acc = acc < value ? value : acc;
+    } else {
+      acc = value < acc ? value : acc;
+    }
+  }
+  static result_type finish(value_type value) { return value; }
+};
+
+template <class T>
+using Min = Extreme<false, T>;
+template <class T>
+using Max = Extreme<true, T>;
+
+// Base of the operators counting adjacent pairs that pass a test
+template <class T>
+struct PairCount {
+  using argument_type = detail::lane_t<T>;
+  using value_type = uint64_t;
+  using result_type = std::size_t;
+  static constexpr bool pairwise = true;
+  static constexpr bool associative = true;
+  static value_type identity() { return 0; }
+  template <class X>
+  static PPC_SIMD_INLINE void combine(X& acc, const X& value) {
+    acc += value;
+  }
+  static result_type finish(value_type value) { return static_cast<result_type>(value); }
+};
+
+// Pairs with data[i + 1] < data[i]
+template <class T>
+struct CountDescents : PairCount<T> {
+  template <class X, class R>
+  static PPC_SIMD_INLINE void transform(const X& x, const X& y, R& out) {
+    detail::indicator(y < x, out);
+  }
+};
+
+// Pairs with strictly opposite signs
+template <class T>
+struct CountSignChanges : PairCount<T> {
+  template <class X, class R>
+  static PPC_SIMD_INLINE void transform(const X& x, const X& y, R& out) {
+    const X zero = {};
+    detail::indicator(((x < zero) & (zero < y)) | ((zero < x) & (y < zero)), out);
+  }
+};
+
+// All operators in one pass over the input: the input is walked in blocks
+// small enough to stay in L1 and every operator reduces each block before the
+// next one is loaded. Results are tuples in the order of Ops.
+template <class... Ops>
+struct Fused {
+  using operators = std::tuple<Ops...>;
+  using value_type = std::tuple<typename Ops::value_type...>;
+  using result_type = std::tuple<typename Ops::result_type...>;
+  static constexpr bool pairwise = false;
+  static constexpr bool associative = (Ops::associative && ...);
+  static value_type identity() { return {Ops::identity()...}; }
+  static void combine(value_type& acc, const value_type& value) {
+    combine_each(acc, value, std::index_sequence_for<Ops...>{});
+  }
+  static result_type finish(const value_type& value) {
+    return std::apply([](const auto&... v) { return result_type{Ops::finish(v)...}; }, value);
+  }
+
+ private:
+  template <std::size_t... I>
+  static void combine_each(value_type& acc, const value_type& value, std::index_sequence<I...>) {
+    (Ops::combine(std::get<I>(acc), std::get<I>(value)), ...);
+  }
+};
+
+}  // namespace ops
+
+namespace detail {
+
+template <class... Ops>
+struct is_fused<ops::Fused<Ops...>> : std::true_type {};
+
+// Elements per block of a fused reduction
+constexpr std::size_t kFusedBlock = 2048;
+
+// Items [i, count) where an item is an element or the pair starting at it
+template <class Op, class T>
+void transform_reduce_scalar(const T* data, std::size_t i, std::size_t count, typename Op::value_type& acc) {
+  using A = typename Op::argument_type;
+  typename Op::value_type value;
+  for (; i < count; i++) {
+    if constexpr (Op::pairwise) {
+      Op::transform(static_cast<A>(data[i]), static_cast<A>(data[i + 1]), value);
+    } else {
+      Op::transform(static_cast<A>(data[i]), value);
+    }
+    Op::combine(acc, value);
+  }
+}
+
+#ifdef PPC_SIMD_X86
+
+template <std::size_t Bytes, class Op, class T>
+PPC_SIMD_INLINE void transform_reduce_vec(const T* data, std::size_t count, std::size_t& i,
+                                          typename Op::value_type& acc) {
+  using V = typename Op::value_type;
+  using AV = vec_t<typename Op::argument_type, Bytes>;
+  using VV = vec_t<V, Bytes>;
+  constexpr std::size_t lanes = Bytes / sizeof(V);
+
+  // broadcast in one step, filling the lanes one by one reads as uninitialized to GCC
+  VV sums[kAccumulators] = {};
+  for (auto& s : sums) s += Op::identity();
+  for (; i + kAccumulators * lanes <= count; i += kAccumulators * lanes) {
+    for (std::size_t k = 0; k < kAccumulators; k++) {
+      AV x;
+      VV value;
+      load_widened<Bytes>(data + i + k * lanes, x);
+      if constexpr (Op::pairwise) {
+        AV y;
+        load_widened<Bytes>(data + i + k * lanes + 1, y);
+        Op::transform(x, y, value);
+      } else {
+        Op::transform(x, value);
+      }
+      Op::combine(sums[k], value);
+    }
+  }
+  for (std::size_t k = 0; k < kAccumulators; k++) {
+    for (std::size_t l = 0; l < lanes; l++) Op::combine(acc, static_cast<V>(sums[k][l]));
+  }
+}
+
+template <class Op, class T>
+void transform_reduce_sse2(const T* data, std::size_t count, std::size_t& i, typename Op::value_type& acc) {
+  transform_reduce_vec<16, Op>(data, count, i, acc);
+}
+template <class Op, class T>
+PPC_SIMD_TARGET_AVX2 void transform_reduce_avx2(const T* data, std::size_t count, std::size_t& i,
+                                                typename Op::value_type& acc) {
+  transform_reduce_vec<32, Op>(data, count, i, acc);
+}
+template <class Op, class T>
+PPC_SIMD_TARGET_AVX512 void transform_reduce_avx512(const T* data, std::size_t count, std::size_t& i,
+                                                    typename Op::value_type& acc) {
+  transform_reduce_vec<64, Op>(data, count, i, acc);
+}
+
+#endif  // PPC_SIMD_X86
+
+// Op over data[0, len) with len > 0, the pair (len - 1, len) is included when has_next
+template <class Op, class T>
+typename Op::value_type transform_reduce_range(const T* data, std::size_t len, bool has_next) {
+  typename Op::value_type acc = Op::identity();
+  if constexpr (is_fused<Op>::value) {
+    using Operators = typename Op::operators;
+    for (std::size_t begin = 0; begin < len; begin += kFusedBlock) {
+      const std::size_t end = std::min(len, begin + kFusedBlock);
+      const bool next = has_next || end < len;
+      [&]<std::size_t... I>(std::index_sequence<I...>) {
+        (std::tuple_element_t<I, Operators>::combine(
+             std::get<I>(acc),
+             transform_reduce_range<std::tuple_element_t<I, Operators>>(data + begin, end - begin, next)),
+         ...);
+      }(std::make_index_sequence<std::tuple_size_v<Operators>>{});
+    }
+  } else {
+    const std::size_t count = Op::pairwise && !has_next ? len - 1 : len;
+    std::size_t i = 0;
+#ifdef PPC_SIMD_X86
+    if constexpr (vectorizable_v<Op>) {
+      switch (active_isa()) {
+        case Isa::AVX512:
+          transform_reduce_avx512<Op>(data, count, i, acc);
+          break;
+        case Isa::AVX2:
+          transform_reduce_avx2<Op>(data, count, i, acc);
+          break;
+        case Isa::SSE2:
+          transform_reduce_sse2<Op>(data, count, i, acc);
+          break;
+        default:
+          break;
+      }
+    }
+#endif
+    transform_reduce_scalar<Op>(data, i, count, acc);
+  }
+  return acc;
+}
+
+}  // namespace detail
+
+// Op::finish of the fold of Op::transform over the n elements (or n - 1
+// adjacent pairs) of data, Op::finish(Op::identity()) when there are none
+template <class Op, class Policy = exec::seq, class T>
+typename Op::result_type transform_reduce(const T* data, std::size_t n) {
+  if (n == 0) return Op::finish(Op::identity());
+  if constexpr (!Op::associative) {
+    return Op::finish(detail::transform_reduce_range<Op>(data, n, false));
+  } else {
+    using V = typename Op::value_type;
+    return Op::finish(exec::chunked_reduce<Policy>(
+        n,
+        [&](std::size_t begin, std::size_t end) {
+          return detail::transform_reduce_range<Op>(data + begin, end - begin, end < n);
+        },
+        [](V acc, const V& value) {
+          Op::combine(acc, value);
+          return acc;
+        }));
+  }
+}
+
+}  // namespace ppc::reference::kernels
+
+#endif  // MODULES_REFERENCE_KERNELS_TRANSFORM_REDUCE_HPP_
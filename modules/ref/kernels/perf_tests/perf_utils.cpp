@@ -0,0 +1,80 @@
+// Copyright 2024 Nesterov Alexander
+#include "ref/kernels/perf_tests/perf_utils.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+#include "core/perf/include/perf.hpp"
+#include "core/perf/include/timer.hpp"
+#include "ref/kernels/func_tests/test_utils.hpp"
+
+namespace {
+
+#ifdef USE_MPI
+const auto* const mpi_environment = ::testing::AddGlobalTestEnvironment(new ppc::reference::test::MpiEnvironment);
+#endif
+
+// seconds every printed measurement should take, well inside the
+// PerfResults::MIN_TIME .. MAX_TIME window the collector accepts
+constexpr double kMeasureSeconds = 0.15;
+constexpr double kCalibrateSeconds = 0.02;
+
+// Repetitions of body that take about kMeasureSeconds, timed in doubling
+// batches so that reading the timer does not count. The first call faults
+// the pages in and warms the caches, so it is left out.
+uint64_t calibrate(const std::function<void()>& body) {
+  body();
+  uint64_t runs = 0;
+  const double begin = ppc::core::timer::steady();
+  double elapsed = 0.0;
+  for (uint64_t batch = 1; elapsed < kCalibrateSeconds; batch *= 2) {
+    for (uint64_t i = 0; i < batch; i++) body();
+    runs += batch;
+    elapsed = ppc::core::timer::steady() - begin;
+  }
+  return std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(kMeasureSeconds * static_cast<double>(runs) / elapsed)));
+}
+
+// Runs the measurement with the calibrated repetitions and, if the machine
+// got faster meanwhile and it came out too short, again with more of them
+void measure(const std::function<void()>& perf_run, ppc::core::PerfAttr& perfAttr,
+             const ppc::core::PerfResults& perfResults) {
+  perf_run();
+  while (perfResults.time_sec < kMeasureSeconds / 2) {
+    const double scale = kMeasureSeconds / std::max(perfResults.time_sec, kMeasureSeconds / 100);
+    perfAttr.num_running = static_cast<uint64_t>(std::ceil(static_cast<double>(perfAttr.num_running) * scale));
+    perf_run();
+  }
+}
+
+}  // namespace
+
+void ppc::reference::test::run_perf(const std::shared_ptr<ppc::core::Task>& task, const std::string& name) {
+  ppc::core::Perf perfAnalyzer(task);
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->current_timer = ppc::core::timer::steady;
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  perfAttr->num_running = calibrate([&task] {
+    task->validation();
+    task->pre_processing();
+    task->run();
+    task->post_processing();
+  });
+  measure([&] { perfAnalyzer.pipeline_run(perfAttr, perfResults); }, *perfAttr, *perfResults);
+  ppc::core::Perf::print_perf_statistic(perfResults, name);
+
+  task->validation();
+  task->pre_processing();
+  perfAttr->num_running = calibrate([&task] { task->run(); });
+  task->post_processing();
+  measure([&] { perfAnalyzer.task_run(perfAttr, perfResults); }, *perfAttr, *perfResults);
+  ppc::core::Perf::print_perf_statistic(perfResults, name);
+}
@@ -0,0 +1,70 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_KERNELS_PERF_UTILS_HPP_
+#define MODULES_REFERENCE_KERNELS_PERF_UTILS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "ref/kernels/include/half.hpp"
+#include "ref/kernels/include/parallel.hpp"
+
+namespace ppc::reference::test {
+
+// input sizes of the perf tests: fits in L1, fits in L2 and far out of cache
+inline const std::vector<std::size_t> perf_sizes = {std::size_t{1} << 10, std::size_t{1} << 16,
+                                                    std::size_t{1} << 22};
+
+// the backends are compared on the largest size only
+inline const std::size_t perf_backend_size = perf_sizes.back();
+
+template <class T>
+std::string type_name() {
+  if constexpr (std::is_same_v<T, kernels::half>) return "half";
+  if constexpr (std::is_same_v<T, kernels::bfloat16>) return "bfloat16";
+  if constexpr (std::is_same_v<T, float>) return "float";
+  if constexpr (std::is_same_v<T, double>) return "double";
+  return (std::is_signed_v<T> ? "int" : "uint") + std::to_string(8 * sizeof(T)) + "_t";
+}
+
+template <class Policy>
+std::string policy_name() {
+  if constexpr (std::is_same_v<Policy, exec::omp>) return "omp";
+  if constexpr (std::is_same_v<Policy, exec::tbb>) return "tbb";
+  if constexpr (std::is_same_v<Policy, exec::stl>) return "stl";
+  if constexpr (std::is_same_v<Policy, exec::mpi>) return "mpi";
+  return "seq";
+}
+
+// <policy>/<type>_<size>: the collector puts the policies of one case side by side
+template <class T, class Policy>
+std::string case_name(std::size_t n) {
+  return policy_name<Policy>() + "/" + type_name<T>() + "_" + std::to_string(n);
+}
+
+// Small values of either sign (unsigned types stay non-negative), so that
+// every sum fits its accumulator and the signs alternate often
+template <class T>
+std::vector<T> perf_input(std::size_t n, unsigned seed = 42) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(std::is_unsigned_v<T> ? 0 : -100, 100);
+  std::vector<T> vec(n);
+  for (auto& x : vec) x = static_cast<T>(static_cast<float>(dist(gen)));
+  return vec;
+}
+
+// Measures the whole pipeline and run() alone, printing both for the perf
+// collector under the path of the test file followed by name. Every
+// measurement repeats the task so that it takes about 0.15 seconds
+// whatever the input size.
+void run_perf(const std::shared_ptr<ppc::core::Task>& task, const std::string& name);
+
+}  // namespace ppc::reference::test
+
+#endif  // MODULES_REFERENCE_KERNELS_PERF_UTILS_HPP_
@@ -0,0 +1,133 @@
+// Copyright 2024 Nesterov Alexander
+#include "ref/kernels/include/mapped_file.hpp"
+
+#include <cerrno>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+std::size_t page_size() {
+#if defined(_WIN32)
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return static_cast<std::size_t>(info.dwPageSize);
+#else
+  static const auto size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+  return size;
+#endif
+}
+
+}  // namespace
+
+ppc::reference::kernels::MappedFile::MappedFile(const std::string& path) {
+#if defined(_WIN32)
+  HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), "open " + path);
+  }
+  LARGE_INTEGER size;
+  GetFileSizeEx(file, &size);
+  size_ = static_cast<std::size_t>(size.QuadPart);
+  if (size_ != 0) {
+    mapping_ = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping_ != nullptr) data_ = static_cast<std::byte*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+  }
+  const auto error = static_cast<int>(GetLastError());
+  CloseHandle(file);
+  if (size_ != 0 && data_ == nullptr) {
+    unmap();
+    throw std::system_error(error, std::system_category(), "map " + path);
+  }
+#else
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) throw std::system_error(errno, std::generic_category(), "open " + path);
+  struct stat st {};
+  if (fstat(fd, &st) != 0) {
+    const int error = errno;
+    close(fd);
+    throw std::system_error(error, std::generic_category(), "stat " + path);
+  }
+  size_ = static_cast<std::size_t>(st.st_size);
+  if (size_ != 0) {
+    void* address = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+    if (address == MAP_FAILED) {
+      const int error = errno;
+      close(fd);
+      size_ = 0;
+      throw std::system_error(error, std::generic_category(), "mmap " + path);
+    }
+    data_ = static_cast<std::byte*>(address);
+    madvise(address, size_, MADV_SEQUENTIAL);
+  }
+  // the mapping keeps the file referenced
+  close(fd);
+#endif
+}
+
+ppc::reference::kernels::MappedFile::MappedFile(MappedFile&& other) noexcept { *this = std::move(other); }
+
+ppc::reference::kernels::MappedFile& ppc::reference::kernels::MappedFile::operator=(MappedFile&& other) noexcept {
+  if (this != &other) {
+    unmap();
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+#if defined(_WIN32)
+    mapping_ = std::exchange(other.mapping_, nullptr);
+#endif
+  }
+  return *this;
+}
+
+ppc::reference::kernels::MappedFile::~MappedFile() { unmap(); }
+
+void ppc::reference::kernels::MappedFile::unmap() {
+#if defined(_WIN32)
+  if (data_ != nullptr) UnmapViewOfFile(data_);
+  if (mapping_ != nullptr) CloseHandle(mapping_);
+  mapping_ = nullptr;
+#else
+  if (data_ != nullptr) munmap(data_, size_);
+#endif
+  data_ = nullptr;
+  size_ = 0;
+}
+
+void ppc::reference::kernels::MappedFile::prefetch(std::size_t begin, std::size_t end) const {
+  end = std::min(end, size_);
+  if (data_ == nullptr || begin >= end) return;
+  // madvise wants a page aligned start
+  begin -= begin % page_size();
+#if defined(_WIN32)
+  WIN32_MEMORY_RANGE_ENTRY range{data_ + begin, end - begin};
+  PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+  madvise(data_ + begin, end - begin, MADV_WILLNEED);
+#endif
+}
+
+void ppc::reference::kernels::MappedFile::release(std::size_t begin, std::size_t end) const {
+  end = std::min(end, size_);
+  // only pages lying entirely inside the range, the neighbours may still be in use
+  begin = (begin + page_size() - 1) / page_size() * page_size();
+  if (end != size_) end -= end % page_size();
+  if (data_ == nullptr || begin >= end) return;
+#if defined(_WIN32)
+  // unlocking pages that are not locked removes them from the working set
+  VirtualUnlock(data_ + begin, end - begin);
+#else
+  madvise(data_ + begin, end - begin, MADV_DONTNEED);
+#endif
+}
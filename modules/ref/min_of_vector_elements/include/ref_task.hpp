@@ -5,28 +5,23 @@
 
 #include <gtest/gtest.h>
 
-#include <algorithm>
 #include <memory>
-#include <numeric>
-#include <vector>
 
 #include "core/task/include/task.hpp"
+#include "ref/kernels/include/reduce.hpp"
+#include "ref/kernels/include/parallel.hpp"
 
 namespace ppc {
 namespace reference {
 
-template <class InOutType, class IndexType>
+template <class InOutType, class IndexType, class Policy = exec::seq>
 class MinOfVectorElements : public ppc::core::Task {
  public:
   explicit MinOfVectorElements(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(taskData_) {}
   bool pre_processing() override {
     internal_order_test();
-    // Init vectors
-    input_ = std::vector<InOutType>(taskData->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InOutType*>(taskData->inputs[0]);
-    for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // Init input, the kernels read it in place
+    input_ = reinterpret_cast<InOutType*>(taskData->inputs[0]);
     // Init value for output
     min = 0.0;
     min_index = 0;
@@ -41,14 +36,14 @@ class MinOfVectorElements : public ppc::core::Task {
     isCountValuesCorrect = taskData->outputs_count[0] == 1;
     isCountIndexesCorrect = taskData->outputs_count[1] == 1;
 
-    return isCountValuesCorrect && isCountIndexesCorrect;
+    return isCountValuesCorrect && isCountIndexesCorrect && taskData->inputs_count[0] > 0;
   }
 
   bool run() override {
     internal_order_test();
-    auto result = std::min_element(input_.begin(), input_.end());
-    min = static_cast<InOutType>(*result);
-    min_index = static_cast<IndexType>(std::distance(input_.begin(), result));
+    auto best = kernels::argmin<Policy>(input_, taskData->inputs_count[0]);
+    min = best.value;
+    min_index = static_cast<IndexType>(best.index);
     return true;
   }
 
@@ -60,7 +55,7 @@ class MinOfVectorElements : public ppc::core::Task {
   }
 
  private:
-  std::vector<InOutType> input_;
+  const InOutType* input_{};
   InOutType min;
   IndexType min_index;
 };
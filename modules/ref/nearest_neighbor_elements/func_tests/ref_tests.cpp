@@ -2,11 +2,49 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <random>
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "ref/kernels/func_tests/test_utils.hpp"
 #include "ref/nearest_neighbor_elements/include/ref_task.hpp"
 
+namespace {
+
+template <class Policy>
+void check_policy_matches_seq() {
+  // Create data
+  const size_t count = 100000;
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int32_t> dist(-1000, 1000);
+  std::vector<int32_t> in(count);
+  for (auto& elem : in) elem = dist(gen);
+  std::vector<int32_t> out_seq(2, 0), out_par(2, 0);
+  std::vector<uint64_t> out_index_seq(2, 0), out_index_par(2, 0);
+
+  auto make_task_data = [&](std::vector<int32_t>& out, std::vector<uint64_t>& out_index) {
+    std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+    taskData->inputs_count.emplace_back(in.size());
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+    taskData->outputs_count.emplace_back(out.size());
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out_index.data()));
+    taskData->outputs_count.emplace_back(out_index.size());
+    return taskData;
+  };
+
+  // Create Task
+  ppc::reference::NearestNeighborElements<int32_t, uint64_t> seqTask(make_task_data(out_seq, out_index_seq));
+  ppc::reference::NearestNeighborElements<int32_t, uint64_t, Policy> parTask(make_task_data(out_par, out_index_par));
+  ppc::reference::test::run_task(seqTask);
+  ppc::reference::test::ScopedConcurrency split;
+  ppc::reference::test::run_task(parTask);
+  EXPECT_EQ(out_par, out_seq);
+  EXPECT_EQ(out_index_par, out_index_seq);
+}
+
+}  // namespace
+
 TEST(nearest_neighbor_elements, check_int32_t) {
   // Create data
   std::vector<int32_t> in(1256, 1);
@@ -204,3 +242,11 @@ TEST(nearest_neighbor_elements, check_float) {
   EXPECT_EQ(out_index[0], 0ull);
   EXPECT_EQ(out_index[1], 1ull);
 }
+
+TEST(nearest_neighbor_elements, check_omp_matches_seq) { check_policy_matches_seq<ppc::reference::exec::omp>(); }
+
+TEST(nearest_neighbor_elements, check_tbb_matches_seq) { check_policy_matches_seq<ppc::reference::exec::tbb>(); }
+
+TEST(nearest_neighbor_elements, check_stl_matches_seq) { check_policy_matches_seq<ppc::reference::exec::stl>(); }
+
+TEST(nearest_neighbor_elements, check_mpi_matches_seq) { check_policy_matches_seq<ppc::reference::exec::mpi>(); }
@@ -5,29 +5,23 @@
 
 #include <gtest/gtest.h>
 
-#include <algorithm>
-#include <functional>
 #include <memory>
-#include <numeric>
-#include <vector>
 
 #include "core/task/include/task.hpp"
+#include "ref/kernels/include/neighbors.hpp"
+#include "ref/kernels/include/parallel.hpp"
 
 namespace ppc {
 namespace reference {
 
-template <class InOutType, class IndexType>
+template <class InOutType, class IndexType, class Policy = exec::seq>
 class NearestNeighborElements : public ppc::core::Task {
  public:
   explicit NearestNeighborElements(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(taskData_) {}
   bool pre_processing() override {
     internal_order_test();
-    // Init vectors
-    input_ = std::vector<InOutType>(taskData->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InOutType*>(taskData->inputs[0]);
-    for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // Init input, the kernels read it in place
+    input_ = reinterpret_cast<InOutType*>(taskData->inputs[0]);
     // Init value for output
     l_elem = r_elem = 0;
     l_elem_index = r_elem_index = 0;
@@ -37,21 +31,12 @@ class NearestNeighborElements : public ppc::core::Task {
   bool validation() override {
     internal_order_test();
     // Check count elements of output
-    return taskData->outputs_count[0] == 2 && taskData->outputs_count[1] == 2;
+    return taskData->inputs_count[0] >= 2 && taskData->outputs_count[0] == 2 && taskData->outputs_count[1] == 2;
   }
 
   bool run() override {
     internal_order_test();
-    auto rotate_in = input_;
-    int rot_left = 1;
-    rotate(rotate_in.begin(), rotate_in.begin() + rot_left, rotate_in.end());
-
-    auto temp_res = std::vector<InOutType>(input_.size());
-    std::transform(input_.begin(), input_.end(), rotate_in.begin(), temp_res.begin(),
-                   [](InOutType x, InOutType y) { return std::abs(x - y); });
-
-    auto result = std::min_element(temp_res.begin(), temp_res.end() - 1);
-    l_elem_index = static_cast<IndexType>(std::distance(temp_res.begin(), result));
+    l_elem_index = static_cast<IndexType>(kernels::nearest_neighbors<Policy>(input_, taskData->inputs_count[0]));
     l_elem = input_[l_elem_index];
 
     r_elem_index = l_elem_index + 1;
@@ -69,7 +54,7 @@ class NearestNeighborElements : public ppc::core::Task {
   }
 
  private:
-  std::vector<InOutType> input_;
+  const InOutType* input_{};
   InOutType l_elem, r_elem;
   IndexType l_elem_index, r_elem_index;
 };
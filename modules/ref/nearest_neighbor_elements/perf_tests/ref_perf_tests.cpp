@@ -0,0 +1,64 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "ref/kernels/perf_tests/perf_utils.hpp"
+#include "ref/nearest_neighbor_elements/include/ref_task.hpp"
+
+namespace test = ppc::reference::test;
+namespace exec = ppc::reference::exec;
+
+namespace {
+
+template <class InType, class Policy = exec::seq>
+void measure(size_t count) {
+  // Create data
+  auto in = test::perf_input<InType>(count);
+  std::vector<InType> out(2, 0);
+  std::vector<uint64_t> out_index(2, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out_index.data()));
+  taskData->outputs_count.emplace_back(out_index.size());
+
+  // Create Task
+  auto testTask = std::make_shared<ppc::reference::NearestNeighborElements<InType, uint64_t, Policy>>(taskData);
+  test::run_perf(testTask, test::case_name<InType, Policy>(count));
+}
+
+}  // namespace
+
+TEST(nearest_neighbor_elements_perf, test_int8_t) {
+  for (auto count : test::perf_sizes) measure<int8_t>(count);
+}
+
+TEST(nearest_neighbor_elements_perf, test_int32_t) {
+  for (auto count : test::perf_sizes) measure<int32_t>(count);
+}
+
+TEST(nearest_neighbor_elements_perf, test_int64_t) {
+  for (auto count : test::perf_sizes) measure<int64_t>(count);
+}
+
+TEST(nearest_neighbor_elements_perf, test_float) {
+  for (auto count : test::perf_sizes) measure<float>(count);
+}
+
+TEST(nearest_neighbor_elements_perf, test_double) {
+  for (auto count : test::perf_sizes) measure<double>(count);
+}
+
+TEST(nearest_neighbor_elements_perf, test_omp) { measure<int32_t, exec::omp>(test::perf_backend_size); }
+
+TEST(nearest_neighbor_elements_perf, test_tbb) { measure<int32_t, exec::tbb>(test::perf_backend_size); }
+
+TEST(nearest_neighbor_elements_perf, test_stl) { measure<int32_t, exec::stl>(test::perf_backend_size); }
+
+TEST(nearest_neighbor_elements_perf, test_mpi) { measure<int32_t, exec::mpi>(test::perf_backend_size); }
@@ -5,29 +5,23 @@
 
 #include <gtest/gtest.h>
 
-#include <algorithm>
-#include <functional>
 #include <memory>
-#include <numeric>
-#include <vector>
 
 #include "core/task/include/task.hpp"
+#include "ref/kernels/include/count.hpp"
+#include "ref/kernels/include/parallel.hpp"
 
 namespace ppc {
 namespace reference {
 
-template <class InOutType, class CountType>
+template <class InOutType, class CountType, class Policy = exec::seq>
 class NumOfAlternationsSigns : public ppc::core::Task {
  public:
   explicit NumOfAlternationsSigns(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(taskData_) {}
   bool pre_processing() override {
     internal_order_test();
-    // Init vectors
-    input_ = std::vector<InOutType>(taskData->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InOutType*>(taskData->inputs[0]);
-    for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // Init input, the kernels read it in place
+    input_ = reinterpret_cast<InOutType*>(taskData->inputs[0]);
     // Init value for output
     num = 0;
     return true;
@@ -41,14 +35,7 @@ class NumOfAlternationsSigns : public ppc::core::Task {
 
   bool run() override {
     internal_order_test();
-    auto rotate_in = input_;
-    int rot_left = 1;
-    rotate(rotate_in.begin(), rotate_in.begin() + rot_left, rotate_in.end());
-
-    auto temp_res = input_;
-    std::transform(input_.begin(), input_.end(), rotate_in.begin(), temp_res.begin(), std::multiplies<>());
-
-    num = std::count_if(temp_res.begin(), temp_res.end() - 1, [](InOutType elem) { return elem < 0; });
+    num = static_cast<CountType>(kernels::count_sign_changes<Policy>(input_, taskData->inputs_count[0]));
     return true;
   }
 
@@ -59,7 +46,7 @@ class NumOfAlternationsSigns : public ppc::core::Task {
   }
 
  private:
-  std::vector<InOutType> input_;
+  const InOutType* input_{};
   CountType num;
 };
 
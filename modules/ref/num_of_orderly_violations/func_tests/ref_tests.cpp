@@ -2,11 +2,45 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <random>
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "ref/kernels/func_tests/test_utils.hpp"
 #include "ref/num_of_orderly_violations/include/ref_task.hpp"
 
+namespace {
+
+template <class Policy>
+void check_policy_matches_seq() {
+  // Create data
+  const size_t count = 100000;
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int32_t> dist(-1000, 1000);
+  std::vector<int32_t> in(count);
+  for (auto& elem : in) elem = dist(gen);
+  std::vector<uint64_t> out_seq(1, 0), out_par(1, 0);
+
+  auto make_task_data = [&](std::vector<uint64_t>& out) {
+    std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+    taskData->inputs_count.emplace_back(in.size());
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+    taskData->outputs_count.emplace_back(out.size());
+    return taskData;
+  };
+
+  // Create Task
+  ppc::reference::NumOfOrderlyViolations<int32_t, uint64_t> seqTask(make_task_data(out_seq));
+  ppc::reference::NumOfOrderlyViolations<int32_t, uint64_t, Policy> parTask(make_task_data(out_par));
+  ppc::reference::test::run_task(seqTask);
+  ppc::reference::test::ScopedConcurrency split;
+  ppc::reference::test::run_task(parTask);
+  EXPECT_EQ(out_par, out_seq);
+}
+
+}  // namespace
+
 TEST(num_of_orderly_violations, check_int32_t) {
   // Create data
   std::vector<int32_t> in(1256, 1);
@@ -144,3 +178,11 @@ TEST(num_of_orderly_violations, check_float) {
   testTask.post_processing();
   ASSERT_EQ(out[0], 1ull);
 }
+
+TEST(num_of_orderly_violations, check_omp_matches_seq) { check_policy_matches_seq<ppc::reference::exec::omp>(); }
+
+TEST(num_of_orderly_violations, check_tbb_matches_seq) { check_policy_matches_seq<ppc::reference::exec::tbb>(); }
+
+TEST(num_of_orderly_violations, check_stl_matches_seq) { check_policy_matches_seq<ppc::reference::exec::stl>(); }
+
+TEST(num_of_orderly_violations, check_mpi_matches_seq) { check_policy_matches_seq<ppc::reference::exec::mpi>(); }
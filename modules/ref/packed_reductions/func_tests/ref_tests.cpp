@@ -0,0 +1,127 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "ref/kernels/func_tests/test_utils.hpp"
+#include "ref/packed_reductions/include/ref_task.hpp"
+
+namespace {
+
+// TaskData reading the packed buffer and writing to the outputs
+std::shared_ptr<ppc::core::TaskData> make_task_data(std::vector<uint8_t>& packed,
+                                                    std::vector<std::vector<uint8_t>>& outputs) {
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(packed.data());
+  taskData->inputs_count.emplace_back(packed.size());
+  for (auto& out : outputs) {
+    taskData->outputs.emplace_back(out.data());
+    taskData->outputs_count.emplace_back(1);
+  }
+  return taskData;
+}
+
+template <class Policy>
+void check_policy_matches_seq() {
+  // Create data
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int32_t> dist(-1000, 1000);
+  std::vector<int32_t> in(100000);
+  for (auto& elem : in) elem = dist(gen);
+  auto packed = ppc::reference::kernels::pack(in.data(), in.size(), ppc::reference::kernels::Encoding::FOR);
+  std::vector<std::vector<uint8_t>> sum_seq(1, std::vector<uint8_t>(sizeof(int64_t))), sum_par = sum_seq;
+  std::vector<std::vector<uint8_t>> min_seq(2, std::vector<uint8_t>(sizeof(int64_t))), min_par = min_seq;
+
+  // Create Task
+  ppc::reference::PackedSum<int32_t, int64_t> seqSumTask(make_task_data(packed, sum_seq));
+  ppc::reference::PackedSum<int32_t, int64_t, Policy> parSumTask(make_task_data(packed, sum_par));
+  ppc::reference::PackedMin<int32_t, uint64_t> seqMinTask(make_task_data(packed, min_seq));
+  ppc::reference::PackedMin<int32_t, uint64_t, Policy> parMinTask(make_task_data(packed, min_par));
+  ppc::reference::test::run_task(seqSumTask);
+  ppc::reference::test::run_task(seqMinTask);
+  ppc::reference::test::ScopedConcurrency split;
+  ppc::reference::test::run_task(parSumTask);
+  ppc::reference::test::run_task(parMinTask);
+  EXPECT_EQ(sum_par, sum_seq);
+  EXPECT_EQ(min_par, min_seq);
+}
+
+}  // namespace
+
+TEST(packed_reductions, check_sum_int16_t) {
+  // Create data
+  std::vector<int16_t> in(2000);
+  for (size_t i = 0; i < in.size(); i++) in[i] = static_cast<int16_t>(i % 100) - 30;
+  auto packed = ppc::reference::kernels::pack(in.data(), in.size(), ppc::reference::kernels::Encoding::FOR);
+  std::vector<std::vector<uint8_t>> out(1, std::vector<uint8_t>(sizeof(int64_t)));
+
+  // Create Task
+  ppc::reference::PackedSum<int16_t, int64_t> testTask(make_task_data(packed, out));
+  ppc::reference::test::run_task(testTask);
+  ASSERT_EQ(reinterpret_cast<int64_t*>(out[0].data())[0], 39000);
+}
+
+TEST(packed_reductions, check_min_max_int32_t) {
+  // Create data
+  std::vector<int32_t> in(3000, 10);
+  in[5] = 3;
+  in[2999] = 3;
+  in[1500] = 40;
+  auto packed = ppc::reference::kernels::pack(in.data(), in.size(), ppc::reference::kernels::Encoding::DELTA);
+  std::vector<std::vector<uint8_t>> min(2, std::vector<uint8_t>(sizeof(int32_t)));
+  std::vector<std::vector<uint8_t>> max(2, std::vector<uint8_t>(sizeof(int32_t)));
+
+  // Create Task
+  ppc::reference::PackedMin<int32_t, uint32_t> minTask(make_task_data(packed, min));
+  ppc::reference::PackedMax<int32_t, uint32_t, ppc::reference::exec::stl> maxTask(make_task_data(packed, max));
+  ppc::reference::test::run_task(minTask);
+  ppc::reference::test::run_task(maxTask);
+  EXPECT_EQ(reinterpret_cast<int32_t*>(min[0].data())[0], 3);
+  EXPECT_EQ(reinterpret_cast<uint32_t*>(min[1].data())[0], 5U);
+  EXPECT_EQ(reinterpret_cast<int32_t*>(max[0].data())[0], 40);
+  EXPECT_EQ(reinterpret_cast<uint32_t*>(max[1].data())[0], 1500U);
+}
+
+TEST(packed_reductions, check_violations_and_alternations) {
+  // Create data
+  std::vector<int8_t> in(1025);
+  for (size_t i = 0; i < in.size(); i++) in[i] = static_cast<int8_t>(i % 2 == 0 ? 1 : -2);
+  auto packed = ppc::reference::kernels::pack(in.data(), in.size(), ppc::reference::kernels::Encoding::FOR);
+  std::vector<std::vector<uint8_t>> violations(1, std::vector<uint8_t>(sizeof(uint32_t)));
+  std::vector<std::vector<uint8_t>> alternations(1, std::vector<uint8_t>(sizeof(uint32_t)));
+
+  // Create Task
+  ppc::reference::PackedNumOfOrderlyViolations<int8_t, uint32_t> violationsTask(make_task_data(packed, violations));
+  ppc::reference::PackedNumOfAlternationsSigns<int8_t, uint32_t> alternationsTask(
+      make_task_data(packed, alternations));
+  ppc::reference::test::run_task(violationsTask);
+  ppc::reference::test::run_task(alternationsTask);
+  EXPECT_EQ(reinterpret_cast<uint32_t*>(violations[0].data())[0], 512U);
+  EXPECT_EQ(reinterpret_cast<uint32_t*>(alternations[0].data())[0], 1024U);
+}
+
+TEST(packed_reductions, check_validate_func) {
+  // Create data
+  std::vector<int32_t> in(100, 1);
+  auto packed = ppc::reference::kernels::pack(in.data(), in.size(), ppc::reference::kernels::Encoding::FOR);
+  std::vector<int32_t> empty_in;
+  auto empty = ppc::reference::kernels::pack(empty_in.data(), 0, ppc::reference::kernels::Encoding::FOR);
+  std::vector<std::vector<uint8_t>> out(2, std::vector<uint8_t>(sizeof(int64_t)));
+
+  // Create Task
+  ppc::reference::PackedSum<int64_t> wrongTypeTask(make_task_data(packed, out));
+  ppc::reference::PackedMax<int32_t, uint32_t> emptyTask(make_task_data(empty, out));
+  EXPECT_EQ(wrongTypeTask.validation(), false);
+  EXPECT_EQ(emptyTask.validation(), false);
+}
+
+TEST(packed_reductions, check_omp_matches_seq) { check_policy_matches_seq<ppc::reference::exec::omp>(); }
+
+TEST(packed_reductions, check_tbb_matches_seq) { check_policy_matches_seq<ppc::reference::exec::tbb>(); }
+
+TEST(packed_reductions, check_stl_matches_seq) { check_policy_matches_seq<ppc::reference::exec::stl>(); }
+
+TEST(packed_reductions, check_mpi_matches_seq) { check_policy_matches_seq<ppc::reference::exec::mpi>(); }
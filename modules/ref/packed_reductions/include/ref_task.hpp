@@ -0,0 +1,155 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_PACKED_REDUCTIONS_REF_TASK_HPP_
+#define MODULES_REFERENCE_PACKED_REDUCTIONS_REF_TASK_HPP_
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "core/task/include/task.hpp"
+#include "ref/kernels/include/accumulator.hpp"
+#include "ref/kernels/include/packed.hpp"
+#include "ref/kernels/include/parallel.hpp"
+
+namespace ppc {
+namespace reference {
+
+// Base of the tasks reducing a compressed integer vector: inputs[0] holds a
+// buffer made by kernels::pack<InType> and inputs_count[0] its size in bytes.
+// The kernels decode it block by block, so only the compressed bytes are
+// read from memory.
+template <class InType>
+class PackedTask : public ppc::core::Task {
+ public:
+  PackedTask(std::shared_ptr<ppc::core::TaskData> taskData_, bool non_empty_)
+      : Task(taskData_), non_empty(non_empty_) {}
+
+  bool validation() override {
+    this->internal_order_test();
+    kernels::PackedView<InType> view(taskData->inputs[0], taskData->inputs_count[0]);
+    if (!view.valid() || (non_empty && view.size() == 0)) return false;
+    for (auto count : taskData->outputs_count) {
+      if (count != 1) return false;
+    }
+    return !taskData->outputs_count.empty();
+  }
+
+  bool pre_processing() override {
+    this->internal_order_test();
+    // Init input, the kernels decode it in place
+    packed = kernels::PackedView<InType>(taskData->inputs[0], taskData->inputs_count[0]);
+    return true;
+  }
+
+ protected:
+  kernels::PackedView<InType> packed;
+
+ private:
+  // the reduction is undefined for an empty vector
+  bool non_empty;
+};
+
+template <class InType, class OutType = InType, class Policy = exec::seq>
+class PackedSum : public PackedTask<InType> {
+ public:
+  explicit PackedSum(std::shared_ptr<ppc::core::TaskData> taskData_) : PackedTask<InType>(taskData_, false) {}
+
+  bool run() override {
+    this->internal_order_test();
+    using Acc = kernels::accumulator_t<InType>;
+    sum = this->packed.size() == 0 ? OutType{0}
+                                   : static_cast<OutType>(kernels::packed_sum<Policy, InType, Acc>(this->packed));
+    return true;
+  }
+
+  bool post_processing() override {
+    this->internal_order_test();
+    reinterpret_cast<OutType*>(this->taskData->outputs[0])[0] = sum;
+    return true;
+  }
+
+ private:
+  OutType sum;
+};
+
+// Writes the first smallest (IsMax = false) or largest element to outputs[0]
+// and its index to outputs[1]
+template <bool IsMax, class InOutType, class IndexType, class Policy = exec::seq>
+class PackedExtremum : public PackedTask<InOutType> {
+ public:
+  explicit PackedExtremum(std::shared_ptr<ppc::core::TaskData> taskData_) : PackedTask<InOutType>(taskData_, true) {}
+
+  bool run() override {
+    this->internal_order_test();
+    index = IsMax ? kernels::packed_max_index<Policy>(this->packed) : kernels::packed_min_index<Policy>(this->packed);
+    return true;
+  }
+
+  bool post_processing() override {
+    this->internal_order_test();
+    // the one element needed is decoded with its block
+    InOutType block[kernels::kPackBlock];
+    this->packed.decode(index / kernels::kPackBlock, block);
+    reinterpret_cast<InOutType*>(this->taskData->outputs[0])[0] = block[index % kernels::kPackBlock];
+    reinterpret_cast<IndexType*>(this->taskData->outputs[1])[0] = static_cast<IndexType>(index);
+    return true;
+  }
+
+ private:
+  std::size_t index;
+};
+
+template <class InOutType, class IndexType, class Policy = exec::seq>
+using PackedMin = PackedExtremum<false, InOutType, IndexType, Policy>;
+template <class InOutType, class IndexType, class Policy = exec::seq>
+using PackedMax = PackedExtremum<true, InOutType, IndexType, Policy>;
+
+template <class InType, class CountType, class Policy = exec::seq>
+class PackedNumOfOrderlyViolations : public PackedTask<InType> {
+ public:
+  explicit PackedNumOfOrderlyViolations(std::shared_ptr<ppc::core::TaskData> taskData_)
+      : PackedTask<InType>(taskData_, false) {}
+
+  bool run() override {
+    this->internal_order_test();
+    num = static_cast<CountType>(kernels::packed_count_descents<Policy>(this->packed));
+    return true;
+  }
+
+  bool post_processing() override {
+    this->internal_order_test();
+    reinterpret_cast<CountType*>(this->taskData->outputs[0])[0] = num;
+    return true;
+  }
+
+ private:
+  CountType num;
+};
+
+template <class InType, class CountType, class Policy = exec::seq>
+class PackedNumOfAlternationsSigns : public PackedTask<InType> {
+ public:
+  explicit PackedNumOfAlternationsSigns(std::shared_ptr<ppc::core::TaskData> taskData_)
+      : PackedTask<InType>(taskData_, false) {}
+
+  bool run() override {
+    this->internal_order_test();
+    num = static_cast<CountType>(kernels::packed_count_sign_changes<Policy>(this->packed));
+    return true;
+  }
+
+  bool post_processing() override {
+    this->internal_order_test();
+    reinterpret_cast<CountType*>(this->taskData->outputs[0])[0] = num;
+    return true;
+  }
+
+ private:
+  CountType num;
+};
+
+}  // namespace reference
+}  // namespace ppc
+
+#endif  // MODULES_REFERENCE_PACKED_REDUCTIONS_REF_TASK_HPP_
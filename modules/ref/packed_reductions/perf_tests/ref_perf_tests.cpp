@@ -0,0 +1,82 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "ref/kernels/perf_tests/perf_utils.hpp"
+#include "ref/packed_reductions/include/ref_task.hpp"
+
+namespace test = ppc::reference::test;
+namespace exec = ppc::reference::exec;
+using ppc::reference::kernels::Encoding;
+
+namespace {
+
+// Packs count elements with the encoding and measures Task over them; the
+// case name tells the encoding since both are decoded by the same kernels
+template <class InType, class Policy, class Task>
+void measure(size_t count, Encoding encoding, size_t outputs_count, const std::string& task_name) {
+  // Create data
+  auto in = test::perf_input<InType>(count);
+  auto packed = ppc::reference::kernels::pack(in.data(), in.size(), encoding);
+  std::vector<std::vector<uint8_t>> outputs(outputs_count, std::vector<uint8_t>(sizeof(uint64_t)));
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(packed.data());
+  taskData->inputs_count.emplace_back(packed.size());
+  for (auto& out : outputs) {
+    taskData->outputs.emplace_back(out.data());
+    taskData->outputs_count.emplace_back(1);
+  }
+
+  // Create Task
+  auto testTask = std::make_shared<Task>(taskData);
+  const std::string encoding_name = encoding == Encoding::FOR ? "for" : "delta";
+  test::run_perf(testTask, test::case_name<InType, Policy>(count) + "_" + encoding_name + "_" + task_name);
+}
+
+template <class InType, class OutType, class Policy = exec::seq>
+void measure_sum(size_t count) {
+  for (auto encoding : {Encoding::FOR, Encoding::DELTA}) {
+    measure<InType, Policy, ppc::reference::PackedSum<InType, OutType, Policy>>(count, encoding, 1, "sum");
+  }
+}
+
+}  // namespace
+
+TEST(packed_reductions_perf, test_int8_t) {
+  for (auto count : test::perf_sizes) {
+    measure<int8_t, exec::seq, ppc::reference::PackedNumOfOrderlyViolations<int8_t, uint32_t>>(count, Encoding::FOR, 1,
+                                                                                               "orderly_violations");
+    measure<int8_t, exec::seq, ppc::reference::PackedNumOfAlternationsSigns<int8_t, uint32_t>>(count, Encoding::FOR, 1,
+                                                                                               "alternations_signs");
+  }
+}
+
+TEST(packed_reductions_perf, test_int16_t) {
+  for (auto count : test::perf_sizes) measure_sum<int16_t, int64_t>(count);
+}
+
+TEST(packed_reductions_perf, test_int32_t) {
+  for (auto count : test::perf_sizes) {
+    measure_sum<int32_t, int64_t>(count);
+    measure<int32_t, exec::seq, ppc::reference::PackedMin<int32_t, uint64_t>>(count, Encoding::FOR, 2, "min");
+    measure<int32_t, exec::seq, ppc::reference::PackedMax<int32_t, uint64_t>>(count, Encoding::FOR, 2, "max");
+  }
+}
+
+TEST(packed_reductions_perf, test_int64_t) {
+  for (auto count : test::perf_sizes) measure_sum<int64_t, int64_t>(count);
+}
+
+TEST(packed_reductions_perf, test_omp) { measure_sum<int32_t, int64_t, exec::omp>(test::perf_backend_size); }
+
+TEST(packed_reductions_perf, test_tbb) { measure_sum<int32_t, int64_t, exec::tbb>(test::perf_backend_size); }
+
+TEST(packed_reductions_perf, test_stl) { measure_sum<int32_t, int64_t, exec::stl>(test::perf_backend_size); }
+
+TEST(packed_reductions_perf, test_mpi) { measure_sum<int32_t, int64_t, exec::mpi>(test::perf_backend_size); }
@@ -0,0 +1,237 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "ref/kernels/func_tests/test_utils.hpp"
+#include "ref/segmented_reductions/include/ref_task.hpp"
+
+namespace {
+
+// Thousands of short segments and one long one, which is split on its own
+template <class Policy>
+void check_policy_matches_seq() {
+  // Create data
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int32_t> dist(-1000, 1000);
+  std::uniform_int_distribution<uint64_t> length(0, 40);
+  std::vector<uint64_t> offsets = {0};
+  while (offsets.back() < 100000) offsets.push_back(offsets.back() + length(gen));
+  offsets.push_back(offsets.back() + 200000);
+  std::vector<int32_t> in(offsets.back());
+  for (auto& elem : in) elem = dist(gen);
+  std::vector<int64_t> out_seq(offsets.size() - 1, 0), out_par(offsets.size() - 1, 0);
+
+  auto make_task_data = [&](std::vector<int64_t>& out) {
+    std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+    taskData->inputs_count.emplace_back(in.size());
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(offsets.data()));
+    taskData->inputs_count.emplace_back(offsets.size());
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+    taskData->outputs_count.emplace_back(out.size());
+    return taskData;
+  };
+
+  // Create Task
+  ppc::reference::SegmentedSum<int32_t, uint64_t> seqTask(make_task_data(out_seq));
+  ppc::reference::SegmentedSum<int32_t, uint64_t, Policy> parTask(make_task_data(out_par));
+  ppc::reference::test::run_task(seqTask);
+  ppc::reference::test::ScopedConcurrency split;
+  ppc::reference::test::run_task(parTask);
+  EXPECT_EQ(out_par, out_seq);
+}
+
+}  // namespace
+
+TEST(segmented_reductions, check_sum_int32_t) {
+  // Create data
+  std::vector<int32_t> in = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  std::vector<uint64_t> offsets = {0, 3, 3, 4, 10};
+  std::vector<int32_t> out(4, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(offsets.data()));
+  taskData->inputs_count.emplace_back(offsets.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  ppc::reference::SegmentedSum<int32_t, uint64_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  ASSERT_EQ(out, std::vector<int32_t>({6, 0, 4, 45}));
+}
+
+TEST(segmented_reductions, check_validate_func) {
+  // Create data
+  std::vector<int32_t> in(10, 1);
+  std::vector<uint64_t> offsets = {0, 5, 3, 10};
+  std::vector<int32_t> out(3, 0);
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(offsets.data()));
+  taskData->inputs_count.emplace_back(offsets.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+  // Create Task
+  ppc::reference::SegmentedSum<int32_t, uint64_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, false);
+}
+
+TEST(segmented_reductions, check_validate_func_empty_segment) {
+  // Create data
+  std::vector<double> in(10, 1);
+  std::vector<uint64_t> offsets = {0, 5, 5, 10};
+  std::vector<double> out(3, 0);
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(offsets.data()));
+  taskData->inputs_count.emplace_back(offsets.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+  // Create Task
+  ppc::reference::SegmentedAverage<double, double, uint64_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, false);
+}
+
+TEST(segmented_reductions, check_average_double) {
+  // Create data
+  std::vector<double> in = {1.5, 2.5, -4.0, 10.0, 0.0, 2.0};
+  std::vector<uint64_t> offsets = {0, 2, 3, 6};
+  std::vector<double> out(3, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(offsets.data()));
+  taskData->inputs_count.emplace_back(offsets.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  ppc::reference::SegmentedAverage<double, double, uint64_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  EXPECT_NEAR(out[0], 2.0, 1e-12);
+  EXPECT_NEAR(out[1], -4.0, 1e-12);
+  EXPECT_NEAR(out[2], 4.0, 1e-12);
+}
+
+TEST(segmented_reductions, check_average_int64_t_does_not_overflow) {
+  // Create data
+  std::vector<int64_t> in = {INT64_MAX, INT64_MAX, -3};
+  std::vector<uint64_t> offsets = {0, 2, 3};
+  std::vector<double> out(2, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(offsets.data()));
+  taskData->inputs_count.emplace_back(offsets.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  ppc::reference::SegmentedAverage<int64_t, double, uint64_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  EXPECT_DOUBLE_EQ(out[0], static_cast<double>(INT64_MAX));
+  EXPECT_DOUBLE_EQ(out[1], -3.0);
+}
+
+TEST(segmented_reductions, check_min_max_int8_t) {
+  // Create data
+  std::vector<int8_t> in = {5, -3, 7, -3, 0, 100, -128, 127};
+  std::vector<uint32_t> offsets = {0, 4, 5, 8};
+  std::vector<int8_t> min(3, 0), max(3, 0);
+  std::vector<uint32_t> min_index(3, 0), max_index(3, 0);
+
+  auto make_task_data = [&](std::vector<int8_t>& value, std::vector<uint32_t>& index) {
+    std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+    taskData->inputs_count.emplace_back(in.size());
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(offsets.data()));
+    taskData->inputs_count.emplace_back(offsets.size());
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(value.data()));
+    taskData->outputs_count.emplace_back(value.size());
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(index.data()));
+    taskData->outputs_count.emplace_back(index.size());
+    return taskData;
+  };
+
+  // Create Task
+  ppc::reference::SegmentedMin<int8_t, uint32_t> minTask(make_task_data(min, min_index));
+  ppc::reference::SegmentedMax<int8_t, uint32_t> maxTask(make_task_data(max, max_index));
+  ppc::reference::test::run_task(minTask);
+  ppc::reference::test::run_task(maxTask);
+  EXPECT_EQ(min, std::vector<int8_t>({-3, 0, -128}));
+  EXPECT_EQ(min_index, std::vector<uint32_t>({1, 0, 1}));
+  EXPECT_EQ(max, std::vector<int8_t>({7, 0, 127}));
+  EXPECT_EQ(max_index, std::vector<uint32_t>({2, 0, 2}));
+}
+
+TEST(segmented_reductions, check_dot_product_stl) {
+  // Create data
+  const size_t segments = 5000;
+  std::vector<uint64_t> offsets = {0};
+  for (size_t s = 0; s < segments; s++) {
+    offsets.push_back(offsets.back() + (s == 100 ? 100000 : s % 17));
+  }
+  std::vector<float> in1(offsets.back(), 0.5f);
+  std::vector<float> in2(offsets.back(), 2.f);
+  std::vector<float> out(segments, -1.f);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in1.data()));
+  taskData->inputs_count.emplace_back(in1.size());
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in2.data()));
+  taskData->inputs_count.emplace_back(in2.size());
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(offsets.data()));
+  taskData->inputs_count.emplace_back(offsets.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  ppc::reference::SegmentedDotProduct<float, uint64_t, ppc::reference::exec::stl> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  for (size_t s = 0; s < segments; s++) {
+    ASSERT_EQ(out[s], static_cast<float>(offsets[s + 1] - offsets[s])) << "segment " << s;
+  }
+}
+
+TEST(segmented_reductions, check_omp_matches_seq) { check_policy_matches_seq<ppc::reference::exec::omp>(); }
+
+TEST(segmented_reductions, check_tbb_matches_seq) { check_policy_matches_seq<ppc::reference::exec::tbb>(); }
+
+TEST(segmented_reductions, check_stl_matches_seq) { check_policy_matches_seq<ppc::reference::exec::stl>(); }
+
+TEST(segmented_reductions, check_mpi_matches_seq) { check_policy_matches_seq<ppc::reference::exec::mpi>(); }
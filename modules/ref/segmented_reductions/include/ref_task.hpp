@@ -0,0 +1,217 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_SEGMENTED_REDUCTIONS_REF_TASK_HPP_
+#define MODULES_REFERENCE_SEGMENTED_REDUCTIONS_REF_TASK_HPP_
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "ref/kernels/include/accumulator.hpp"
+#include "ref/kernels/include/parallel.hpp"
+#include "ref/kernels/include/segmented.hpp"
+
+namespace ppc {
+namespace reference {
+
+// Reductions over many variable-length vectors packed into one values buffer.
+// The last input holds segments + 1 offsets (CSR layout): segment s is
+// values[offsets[s], offsets[s + 1]). Every output holds one entry per segment.
+template <class OffsetType>
+class SegmentedTask : public ppc::core::Task {
+ public:
+  explicit SegmentedTask(std::shared_ptr<ppc::core::TaskData> taskData_, size_t values_inputs_, bool non_empty_)
+      : Task(taskData_), values_inputs(values_inputs_), non_empty(non_empty_) {}
+
+  bool validation() override {
+    internal_order_test();
+    if (taskData->inputs.size() != values_inputs + 1 || taskData->inputs_count[values_inputs] == 0) return false;
+    // Check offsets
+    auto offsets = reinterpret_cast<OffsetType*>(taskData->inputs[values_inputs]);
+    const size_t segments = taskData->inputs_count[values_inputs] - 1;
+    if (offsets[0] != 0 || offsets[segments] != taskData->inputs_count[0]) return false;
+    for (size_t s = 0; s < segments; s++) {
+      if (offsets[s + 1] < offsets[s] || (non_empty && offsets[s + 1] == offsets[s])) return false;
+    }
+    for (size_t i = 1; i < values_inputs; i++) {
+      if (taskData->inputs_count[i] != taskData->inputs_count[0]) return false;
+    }
+    // Check count elements of output
+    for (auto count : taskData->outputs_count) {
+      if (count != segments) return false;
+    }
+    return !taskData->outputs.empty();
+  }
+
+ protected:
+  void init_offsets() {
+    offsets = reinterpret_cast<OffsetType*>(taskData->inputs[values_inputs]);
+    segments = taskData->inputs_count[values_inputs] - 1;
+  }
+
+  const OffsetType* offsets{};
+  size_t segments{};
+
+ private:
+  size_t values_inputs;
+  bool non_empty;
+};
+
+template <class InType, class OffsetType, class Policy = exec::seq>
+class SegmentedSum : public SegmentedTask<OffsetType> {
+ public:
+  explicit SegmentedSum(std::shared_ptr<ppc::core::TaskData> taskData_)
+      : SegmentedTask<OffsetType>(taskData_, 1, false) {}
+  bool pre_processing() override {
+    this->internal_order_test();
+    // Init input, the kernels read it in place
+    input_ = reinterpret_cast<InType*>(this->taskData->inputs[0]);
+    this->init_offsets();
+    // Init value for output
+    sum_ = std::vector<kernels::accumulator_t<InType>>(this->segments, 0);
+    return true;
+  }
+
+  bool run() override {
+    this->internal_order_test();
+    kernels::segmented_sum<Policy>(input_, this->offsets, this->segments, sum_.data());
+    return true;
+  }
+
+  bool post_processing() override {
+    this->internal_order_test();
+    for (size_t s = 0; s < this->segments; s++) {
+      reinterpret_cast<InType*>(this->taskData->outputs[0])[s] = static_cast<InType>(sum_[s]);
+    }
+    return true;
+  }
+
+ private:
+  const InType* input_{};
+  std::vector<kernels::accumulator_t<InType>> sum_;
+};
+
+template <class InType, class OutType, class OffsetType, class Policy = exec::seq>
+class SegmentedAverage : public SegmentedTask<OffsetType> {
+ public:
+  explicit SegmentedAverage(std::shared_ptr<ppc::core::TaskData> taskData_)
+      : SegmentedTask<OffsetType>(taskData_, 1, true) {}
+  bool pre_processing() override {
+    this->internal_order_test();
+    // Init input, the kernels read it in place
+    input_ = reinterpret_cast<InType*>(this->taskData->inputs[0]);
+    this->init_offsets();
+    // Init value for output
+    sum_ = std::vector<kernels::average_accumulator_t<InType>>(this->segments, 0);
+    return true;
+  }
+
+  bool run() override {
+    this->internal_order_test();
+    kernels::segmented_sum<Policy>(input_, this->offsets, this->segments, sum_.data());
+    return true;
+  }
+
+  bool post_processing() override {
+    this->internal_order_test();
+    for (size_t s = 0; s < this->segments; s++) {
+      reinterpret_cast<OutType*>(this->taskData->outputs[0])[s] =
+          static_cast<OutType>(sum_[s]) / static_cast<OutType>(this->offsets[s + 1] - this->offsets[s]);
+    }
+    return true;
+  }
+
+ private:
+  const InType* input_{};
+  std::vector<kernels::average_accumulator_t<InType>> sum_;
+};
+
+// The first output receives the extreme values, the second their indices
+// inside the segment
+template <bool IsMax, class InType, class OffsetType, class Policy = exec::seq>
+class SegmentedExtremum : public SegmentedTask<OffsetType> {
+ public:
+  explicit SegmentedExtremum(std::shared_ptr<ppc::core::TaskData> taskData_)
+      : SegmentedTask<OffsetType>(taskData_, 1, true) {}
+  bool validation() override { return SegmentedTask<OffsetType>::validation() && this->taskData->outputs.size() == 2; }
+
+  bool pre_processing() override {
+    this->internal_order_test();
+    // Init input, the kernels read it in place
+    input_ = reinterpret_cast<InType*>(this->taskData->inputs[0]);
+    this->init_offsets();
+    // Init values for output
+    value_ = std::vector<InType>(this->segments);
+    index_ = std::vector<OffsetType>(this->segments);
+    return true;
+  }
+
+  bool run() override {
+    this->internal_order_test();
+    kernels::segmented_extremum<IsMax, Policy>(input_, this->offsets, this->segments, value_.data(), index_.data());
+    return true;
+  }
+
+  bool post_processing() override {
+    this->internal_order_test();
+    for (size_t s = 0; s < this->segments; s++) {
+      reinterpret_cast<InType*>(this->taskData->outputs[0])[s] = value_[s];
+      reinterpret_cast<OffsetType*>(this->taskData->outputs[1])[s] = index_[s];
+    }
+    return true;
+  }
+
+ private:
+  const InType* input_{};
+  std::vector<InType> value_;
+  std::vector<OffsetType> index_;
+};
+
+template <class InType, class OffsetType, class Policy = exec::seq>
+using SegmentedMin = SegmentedExtremum<false, InType, OffsetType, Policy>;
+
+template <class InType, class OffsetType, class Policy = exec::seq>
+using SegmentedMax = SegmentedExtremum<true, InType, OffsetType, Policy>;
+
+// Inputs: the two values buffers, then the offsets shared by both
+template <class InType, class OffsetType, class Policy = exec::seq>
+class SegmentedDotProduct : public SegmentedTask<OffsetType> {
+ public:
+  explicit SegmentedDotProduct(std::shared_ptr<ppc::core::TaskData> taskData_)
+      : SegmentedTask<OffsetType>(taskData_, 2, false) {}
+  bool pre_processing() override {
+    this->internal_order_test();
+    // Init inputs, the kernels read them in place
+    input_[0] = reinterpret_cast<InType*>(this->taskData->inputs[0]);
+    input_[1] = reinterpret_cast<InType*>(this->taskData->inputs[1]);
+    this->init_offsets();
+    // Init value for output
+    dot_ = std::vector<InType>(this->segments, 0);
+    return true;
+  }
+
+  bool run() override {
+    this->internal_order_test();
+    kernels::segmented_dot<Policy>(input_[0], input_[1], this->offsets, this->segments, dot_.data());
+    return true;
+  }
+
+  bool post_processing() override {
+    this->internal_order_test();
+    for (size_t s = 0; s < this->segments; s++) {
+      reinterpret_cast<InType*>(this->taskData->outputs[0])[s] = dot_[s];
+    }
+    return true;
+  }
+
+ private:
+  const InType* input_[2]{};
+  std::vector<InType> dot_;
+};
+
+}  // namespace reference
+}  // namespace ppc
+
+#endif  // MODULES_REFERENCE_SEGMENTED_REDUCTIONS_REF_TASK_HPP_
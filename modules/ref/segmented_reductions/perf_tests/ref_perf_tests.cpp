@@ -0,0 +1,93 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "ref/kernels/perf_tests/perf_utils.hpp"
+#include "ref/segmented_reductions/include/ref_task.hpp"
+
+namespace test = ppc::reference::test;
+namespace exec = ppc::reference::exec;
+
+namespace {
+
+// Offsets of non-empty segments of 1 to 40 elements covering count elements
+std::vector<uint64_t> make_offsets(size_t count) {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<uint64_t> length(1, 40);
+  std::vector<uint64_t> offsets = {0};
+  while (offsets.back() < count) offsets.push_back(std::min<uint64_t>(offsets.back() + length(gen), count));
+  return offsets;
+}
+
+// Measures Task over count elements split into short segments, values_inputs
+// value vectors share the segments
+template <class InType, class Policy, class Task>
+void measure(size_t count, size_t values_inputs, size_t outputs_count, const std::string& task_name) {
+  // Create data
+  std::vector<std::vector<InType>> in;
+  for (size_t i = 0; i < values_inputs; i++) in.push_back(test::perf_input<InType>(count, 42 + i));
+  auto offsets = make_offsets(count);
+  const size_t segments = offsets.size() - 1;
+  std::vector<std::vector<uint64_t>> outputs(outputs_count, std::vector<uint64_t>(segments));
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  for (auto& values : in) {
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(values.data()));
+    taskData->inputs_count.emplace_back(values.size());
+  }
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(offsets.data()));
+  taskData->inputs_count.emplace_back(offsets.size());
+  for (auto& out : outputs) {
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+    taskData->outputs_count.emplace_back(segments);
+  }
+
+  // Create Task
+  auto testTask = std::make_shared<Task>(taskData);
+  test::run_perf(testTask, test::case_name<InType, Policy>(count) + "_" + task_name);
+}
+
+template <class Policy = exec::seq>
+void measure_sum(size_t count) {
+  measure<int32_t, Policy, ppc::reference::SegmentedSum<int32_t, uint64_t, Policy>>(count, 1, 1, "sum");
+}
+
+}  // namespace
+
+TEST(segmented_reductions_perf, test_int8_t) {
+  for (auto count : test::perf_sizes) {
+    measure<int8_t, exec::seq, ppc::reference::SegmentedMin<int8_t, uint64_t>>(count, 1, 2, "min");
+    measure<int8_t, exec::seq, ppc::reference::SegmentedMax<int8_t, uint64_t>>(count, 1, 2, "max");
+  }
+}
+
+TEST(segmented_reductions_perf, test_int32_t) {
+  for (auto count : test::perf_sizes) measure_sum(count);
+}
+
+TEST(segmented_reductions_perf, test_float) {
+  for (auto count : test::perf_sizes) {
+    measure<float, exec::seq, ppc::reference::SegmentedDotProduct<float, uint64_t>>(count, 2, 1, "dot_product");
+  }
+}
+
+TEST(segmented_reductions_perf, test_double) {
+  for (auto count : test::perf_sizes) {
+    measure<double, exec::seq, ppc::reference::SegmentedAverage<double, double, uint64_t>>(count, 1, 1, "average");
+  }
+}
+
+TEST(segmented_reductions_perf, test_omp) { measure_sum<exec::omp>(test::perf_backend_size); }
+
+TEST(segmented_reductions_perf, test_tbb) { measure_sum<exec::tbb>(test::perf_backend_size); }
+
+TEST(segmented_reductions_perf, test_stl) { measure_sum<exec::stl>(test::perf_backend_size); }
+
+TEST(segmented_reductions_perf, test_mpi) { measure_sum<exec::mpi>(test::perf_backend_size); }
@@ -1,11 +1,45 @@
 // Copyright 2023 Nesterov Alexander
 #include <gtest/gtest.h>
 
+#include <random>
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "ref/kernels/func_tests/test_utils.hpp"
 #include "ref/sum_of_vector_elements/include/ref_task.hpp"
 
+namespace {
+
+template <class Policy>
+void check_policy_matches_seq() {
+  // Create data
+  const size_t count = 100000;
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int32_t> dist(-1000, 1000);
+  std::vector<int32_t> in(count);
+  for (auto& elem : in) elem = dist(gen);
+  std::vector<int64_t> out_seq(1, 0), out_par(1, 0);
+
+  auto make_task_data = [&](std::vector<int64_t>& out) {
+    std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+    taskData->inputs_count.emplace_back(in.size());
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+    taskData->outputs_count.emplace_back(out.size());
+    return taskData;
+  };
+
+  // Create Task
+  ppc::reference::SumOfVectorElements<int32_t, int64_t> seqTask(make_task_data(out_seq));
+  ppc::reference::SumOfVectorElements<int32_t, int64_t, Policy> parTask(make_task_data(out_par));
+  ppc::reference::test::run_task(seqTask);
+  ppc::reference::test::ScopedConcurrency split;
+  ppc::reference::test::run_task(parTask);
+  EXPECT_EQ(out_par, out_seq);
+}
+
+}  // namespace
+
 TEST(sum_of_vector_elements, check_int32_t) {
   // Create data
   std::vector<int32_t> in(1256, 1);
@@ -121,3 +155,82 @@ TEST(sum_of_vector_elements, check_float) {
   testTask.post_processing();
   EXPECT_NEAR(out[0], static_cast<float>(in.size()), 1e-3f);
 }
+
+TEST(sum_of_vector_elements, check_uint8_t_widening) {
+  // Create data
+  std::vector<uint8_t> in(100000, 255);
+  std::vector<uint64_t> out(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  ppc::reference::SumOfVectorElements<uint8_t, uint64_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  ASSERT_EQ(out[0], 255ull * in.size());
+}
+
+TEST(sum_of_vector_elements, check_deterministic_float) {
+  // Create data
+  std::vector<float> in(1000000);
+  for (size_t i = 0; i < in.size(); i++) {
+    in[i] = 1.f / static_cast<float>(i % 1000 + 1);
+  }
+  std::vector<float> out_seq(1, 0.f), out_par(1, 0.f);
+
+  auto make_task_data = [&](std::vector<float>& out) {
+    std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+    taskData->inputs_count.emplace_back(in.size());
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+    taskData->outputs_count.emplace_back(out.size());
+    return taskData;
+  };
+
+  // Create Task
+  using ppc::reference::exec::deterministic;
+  ppc::reference::SumOfVectorElements<float, float, deterministic<ppc::reference::exec::seq>> seqTask(
+      make_task_data(out_seq));
+  ppc::reference::SumOfVectorElements<float, float, deterministic<ppc::reference::exec::stl>> parTask(
+      make_task_data(out_par));
+  ppc::reference::test::run_task(seqTask);
+  ppc::reference::test::run_task(parTask);
+  EXPECT_EQ(out_par[0], out_seq[0]);
+  EXPECT_NEAR(out_seq[0], 1000 * 7.485470861, 1e-1);
+}
+
+TEST(sum_of_vector_elements, check_half_float_output) {
+  // Create data, the sum is past the largest integer a half holds exactly
+  std::vector<ppc::reference::kernels::half> in(3000, ppc::reference::kernels::half(1.5f));
+  std::vector<float> out(1, 0.f);
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+  // Create Task
+  ppc::reference::SumOfVectorElements<ppc::reference::kernels::half, float> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  ASSERT_EQ(out[0], 4500.f);
+}
+
+TEST(sum_of_vector_elements, check_omp_matches_seq) { check_policy_matches_seq<ppc::reference::exec::omp>(); }
+
+TEST(sum_of_vector_elements, check_tbb_matches_seq) { check_policy_matches_seq<ppc::reference::exec::tbb>(); }
+
+TEST(sum_of_vector_elements, check_stl_matches_seq) { check_policy_matches_seq<ppc::reference::exec::stl>(); }
+
+TEST(sum_of_vector_elements, check_mpi_matches_seq) { check_policy_matches_seq<ppc::reference::exec::mpi>(); }
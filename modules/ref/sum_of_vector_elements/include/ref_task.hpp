@@ -5,25 +5,22 @@
 #include <gtest/gtest.h>
 
 #include <memory>
-#include <numeric>
-#include <vector>
 
 #include "core/task/include/task.hpp"
+#include "ref/kernels/include/accumulator.hpp"
+#include "ref/kernels/include/parallel.hpp"
+#include "ref/kernels/include/reduce.hpp"
 
 namespace ppc::reference {
 
-template <class InOutType>
+template <class InType, class OutType = InType, class Policy = exec::seq>
 class SumOfVectorElements : public ppc::core::Task {
  public:
   explicit SumOfVectorElements(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(taskData_) {}
   bool pre_processing() override {
     internal_order_test();
-    // Init vectors
-    input_ = std::vector<InOutType>(taskData->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InOutType*>(taskData->inputs[0]);
-    for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // Init input, the kernels read it in place
+    input_ = reinterpret_cast<InType*>(taskData->inputs[0]);
     // Init value for output
     sum = 0;
     return true;
@@ -37,19 +34,21 @@ class SumOfVectorElements : public ppc::core::Task {
 
   bool run() override {
     internal_order_test();
-    sum = std::accumulate(input_.begin(), input_.end(), 0);
+    // the accumulator is wide enough for any input, the result is narrowed once
+    using Acc = kernels::accumulator_t<InType>;
+    sum = static_cast<OutType>(kernels::parallel_sum<Policy, InType, Acc>(input_, taskData->inputs_count[0]));
     return true;
   }
 
   bool post_processing() override {
     internal_order_test();
-    reinterpret_cast<InOutType*>(taskData->outputs[0])[0] = sum;
+    reinterpret_cast<OutType*>(taskData->outputs[0])[0] = sum;
     return true;
   }
 
  private:
-  std::vector<InOutType> input_;
-  InOutType sum;
+  const InType* input_{};
+  OutType sum;
 };
 
 }  // namespace ppc::reference
@@ -4,8 +4,45 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "ref/kernels/func_tests/test_utils.hpp"
 #include "ref/sum_values_by_rows_matrix/include/ref_task.hpp"
 
+namespace {
+
+template <class Policy>
+void check_policy_matches_seq() {
+  // Create data
+  const uint64_t rows = 2000;
+  const uint64_t cols = 300;
+  std::vector<int64_t> in(rows * cols);
+  std::vector<uint64_t> in_index = {rows, cols};
+  for (size_t i = 0; i < in.size(); i++) {
+    in[i] = static_cast<int64_t>(i % 101) - 50;
+  }
+  std::vector<int64_t> out_seq(rows, 0), out_par(rows, 0);
+
+  auto make_task_data = [&](std::vector<int64_t>& out) {
+    std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+    taskData->inputs_count.emplace_back(in.size());
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in_index.data()));
+    taskData->inputs_count.emplace_back(in_index.size());
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+    taskData->outputs_count.emplace_back(out.size());
+    return taskData;
+  };
+
+  // Create Task
+  ppc::reference::SumValuesByRowsMatrix<int64_t, uint64_t> seqTask(make_task_data(out_seq));
+  ppc::reference::SumValuesByRowsMatrix<int64_t, uint64_t, Policy> parTask(make_task_data(out_par));
+  ppc::reference::test::run_task(seqTask);
+  ppc::reference::test::ScopedConcurrency split;
+  ppc::reference::test::run_task(parTask);
+  EXPECT_EQ(out_par, out_seq);
+}
+
+}  // namespace
+
 TEST(sum_values_by_rows_matrix, check_int32_t) {
   // Create data
   std::vector<int32_t> in(1369, 2);
@@ -192,3 +229,43 @@ TEST(sum_values_by_rows_matrix, check_float) {
     EXPECT_NEAR(out[i], in_index[1] * (in_index[1] + 1) * (2 * in_index[1] + 1) / 6.f, 1e-6);
   }
 }
+
+TEST(sum_values_by_rows_matrix, check_tall_double) {
+  // Create data
+  const uint64_t rows = 1000;
+  const uint64_t cols = 3;
+  std::vector<double> in(rows * cols);
+  std::vector<uint64_t> in_index = {rows, cols};
+  std::vector<double> out(rows, 0);
+  for (size_t i = 0; i < in.size(); i++) {
+    in[i] = static_cast<double>(i / cols) + 0.25;
+  }
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in_index.data()));
+  taskData->inputs_count.emplace_back(in_index.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  ppc::reference::SumValuesByRowsMatrix<double, uint64_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  for (size_t i = 0; i < rows; i++) {
+    ASSERT_EQ(out[i], 3.0 * static_cast<double>(i) + 0.75);
+  }
+}
+
+TEST(sum_values_by_rows_matrix, check_omp_matches_seq) { check_policy_matches_seq<ppc::reference::exec::omp>(); }
+
+TEST(sum_values_by_rows_matrix, check_tbb_matches_seq) { check_policy_matches_seq<ppc::reference::exec::tbb>(); }
+
+TEST(sum_values_by_rows_matrix, check_stl_matches_seq) { check_policy_matches_seq<ppc::reference::exec::stl>(); }
+
+TEST(sum_values_by_rows_matrix, check_mpi_matches_seq) { check_policy_matches_seq<ppc::reference::exec::mpi>(); }
@@ -6,31 +6,28 @@
 #include <gtest/gtest.h>
 
 #include <memory>
-#include <numeric>
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "ref/kernels/include/matrix.hpp"
+#include "ref/kernels/include/parallel.hpp"
 
 namespace ppc {
 namespace reference {
 
-template <class InOutType, class IndexType>
+template <class InOutType, class IndexType, class Policy = exec::seq>
 class SumValuesByRowsMatrix : public ppc::core::Task {
  public:
   explicit SumValuesByRowsMatrix(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(taskData_) {}
   bool pre_processing() override {
     internal_order_test();
-    // Init vectors
-    input_ = std::vector<InOutType>(taskData->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InOutType*>(taskData->inputs[0]);
-    for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // Init input, the kernels read it in place
+    input_ = reinterpret_cast<InOutType*>(taskData->inputs[0]);
     rows = reinterpret_cast<IndexType*>(taskData->inputs[1])[0];
     cols = reinterpret_cast<IndexType*>(taskData->inputs[1])[1];
 
     // Init value for output
-    sum_ = std::vector<InOutType>(cols, 0.f);
+    sum_ = std::vector<InOutType>(rows, 0);
     return true;
   }
 
@@ -43,9 +40,7 @@ class SumValuesByRowsMatrix : public ppc::core::Task {
 
   bool run() override {
     internal_order_test();
-    for (size_t i = 0; i < rows; i++) {
-      sum_[i] = std::accumulate(input_.begin() + cols * i, input_.begin() + cols * (i + 1), 0.f);
-    }
+    kernels::row_sums<Policy>(kernels::MatrixView<InOutType>::row_major(input_, rows, cols), sum_.data());
     return true;
   }
 
@@ -58,7 +53,7 @@ class SumValuesByRowsMatrix : public ppc::core::Task {
   }
 
  private:
-  std::vector<InOutType> input_;
+  const InOutType* input_{};
   IndexType rows, cols;
   std::vector<InOutType> sum_;
 };
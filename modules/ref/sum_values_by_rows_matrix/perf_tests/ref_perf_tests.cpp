@@ -0,0 +1,67 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "ref/kernels/perf_tests/perf_utils.hpp"
+#include "ref/sum_values_by_rows_matrix/include/ref_task.hpp"
+
+namespace test = ppc::reference::test;
+namespace exec = ppc::reference::exec;
+
+namespace {
+
+// A square matrix of count elements
+template <class InOutType, class Policy = exec::seq>
+void measure(size_t count) {
+  // Create data
+  const auto rows = static_cast<uint64_t>(std::sqrt(static_cast<double>(count)));
+  auto in = test::perf_input<InOutType>(rows * rows);
+  std::vector<uint64_t> in_index = {rows, rows};
+  std::vector<InOutType> out(rows, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in_index.data()));
+  taskData->inputs_count.emplace_back(in_index.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto testTask = std::make_shared<ppc::reference::SumValuesByRowsMatrix<InOutType, uint64_t, Policy>>(taskData);
+  test::run_perf(testTask, test::case_name<InOutType, Policy>(count));
+}
+
+}  // namespace
+
+TEST(sum_values_by_rows_matrix_perf, test_int8_t) {
+  for (auto count : test::perf_sizes) measure<int8_t>(count);
+}
+
+TEST(sum_values_by_rows_matrix_perf, test_int32_t) {
+  for (auto count : test::perf_sizes) measure<int32_t>(count);
+}
+
+TEST(sum_values_by_rows_matrix_perf, test_int64_t) {
+  for (auto count : test::perf_sizes) measure<int64_t>(count);
+}
+
+TEST(sum_values_by_rows_matrix_perf, test_float) {
+  for (auto count : test::perf_sizes) measure<float>(count);
+}
+
+TEST(sum_values_by_rows_matrix_perf, test_double) {
+  for (auto count : test::perf_sizes) measure<double>(count);
+}
+
+TEST(sum_values_by_rows_matrix_perf, test_omp) { measure<int64_t, exec::omp>(test::perf_backend_size); }
+
+TEST(sum_values_by_rows_matrix_perf, test_tbb) { measure<int64_t, exec::tbb>(test::perf_backend_size); }
+
+TEST(sum_values_by_rows_matrix_perf, test_stl) { measure<int64_t, exec::stl>(test::perf_backend_size); }
+
+TEST(sum_values_by_rows_matrix_perf, test_mpi) { measure<int64_t, exec::mpi>(test::perf_backend_size); }
@@ -0,0 +1,127 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "ref/kernels/func_tests/test_utils.hpp"
+#include "ref/transform_reductions/include/ref_task.hpp"
+
+namespace ops = ppc::reference::kernels::ops;
+
+namespace {
+
+template <class Policy>
+void check_policy_matches_seq() {
+  // Create data
+  const size_t count = 100000;
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int32_t> dist(-1000, 1000);
+  std::vector<int32_t> in(count);
+  for (auto& elem : in) elem = dist(gen);
+  std::vector<int64_t> sum_seq(1, 0), sum_par(1, 0);
+  std::vector<uint64_t> descents_seq(1, 0), descents_par(1, 0);
+
+  auto make_task_data = [&](std::vector<int64_t>& sum, std::vector<uint64_t>& descents) {
+    std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+    taskData->inputs_count.emplace_back(in.size());
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(sum.data()));
+    taskData->outputs_count.emplace_back(sum.size());
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(descents.data()));
+    taskData->outputs_count.emplace_back(descents.size());
+    return taskData;
+  };
+
+  // Create Task
+  using Op = ops::Fused<ops::Sum<int32_t>, ops::CountDescents<int32_t>>;
+  ppc::reference::Reduce<Op, int32_t> seqTask(make_task_data(sum_seq, descents_seq));
+  ppc::reference::Reduce<Op, int32_t, Policy> parTask(make_task_data(sum_par, descents_par));
+  ppc::reference::test::run_task(seqTask);
+  ppc::reference::test::ScopedConcurrency split;
+  ppc::reference::test::run_task(parTask);
+  EXPECT_EQ(sum_par, sum_seq);
+  EXPECT_EQ(descents_par, descents_seq);
+}
+
+}  // namespace
+
+TEST(transform_reductions, check_sum_of_squares_int16_t) {
+  // Create data
+  std::vector<int16_t> in(1000);
+  for (size_t i = 0; i < in.size(); i++) in[i] = static_cast<int16_t>(i % 10) - 5;
+  std::vector<int64_t> out(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  ppc::reference::Reduce<ops::SumOfSquares<int16_t>, int16_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  ASSERT_EQ(out[0], 8500);
+}
+
+TEST(transform_reductions, check_fused_double) {
+  // Create data
+  std::vector<double> in = {1.5, -2.0, 3.0, 0.0, 4.0, -1.0};
+  std::vector<double> min(1, 0), max(1, 0);
+  std::vector<uint64_t> alternations(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(min.data()));
+  taskData->outputs_count.emplace_back(min.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(max.data()));
+  taskData->outputs_count.emplace_back(max.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(alternations.data()));
+  taskData->outputs_count.emplace_back(alternations.size());
+
+  // Create Task
+  using Op = ops::Fused<ops::Min<double>, ops::Max<double>, ops::CountSignChanges<double>>;
+  ppc::reference::Reduce<Op, double> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  EXPECT_EQ(min[0], -2.0);
+  EXPECT_EQ(max[0], 4.0);
+  EXPECT_EQ(alternations[0], 3U);
+}
+
+TEST(transform_reductions, check_validate_func) {
+  // Create data
+  std::vector<int32_t> in(10, 1);
+  std::vector<int64_t> out(1, 0);
+
+  // Create TaskData, a fused operator with two results gets one output
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  ppc::reference::Reduce<ops::Fused<ops::Sum<int32_t>, ops::Max<int32_t>>, int32_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, false);
+}
+
+TEST(transform_reductions, check_omp_matches_seq) { check_policy_matches_seq<ppc::reference::exec::omp>(); }
+
+TEST(transform_reductions, check_tbb_matches_seq) { check_policy_matches_seq<ppc::reference::exec::tbb>(); }
+
+TEST(transform_reductions, check_stl_matches_seq) { check_policy_matches_seq<ppc::reference::exec::stl>(); }
+
+TEST(transform_reductions, check_mpi_matches_seq) { check_policy_matches_seq<ppc::reference::exec::mpi>(); }
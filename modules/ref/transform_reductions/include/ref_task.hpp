@@ -0,0 +1,83 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_TRANSFORM_REDUCTIONS_REF_TASK_HPP_
+#define MODULES_REFERENCE_TRANSFORM_REDUCTIONS_REF_TASK_HPP_
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <tuple>
+#include <type_traits>
+
+#include "core/task/include/task.hpp"
+#include "ref/kernels/include/parallel.hpp"
+#include "ref/kernels/include/transform_reduce.hpp"
+
+namespace ppc {
+namespace reference {
+
+// Any kernels::transform_reduce operator as a task: the input vector is read
+// in place and the result is written to outputs[0] as Op::result_type. Fused
+// operators write element k of their result to outputs[k].
+template <class Op, class InType, class Policy = exec::seq>
+class Reduce : public ppc::core::Task {
+ public:
+  explicit Reduce(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(taskData_) {}
+  bool pre_processing() override {
+    internal_order_test();
+    // Init input, the kernels read it in place
+    input_ = reinterpret_cast<InType*>(taskData->inputs[0]);
+    // Init value for output
+    result = Op::finish(Op::identity());
+    return true;
+  }
+
+  bool validation() override {
+    internal_order_test();
+    // Check count elements of output
+    if (taskData->outputs.size() != outputs) return false;
+    for (auto count : taskData->outputs_count) {
+      if (count != 1) return false;
+    }
+    return true;
+  }
+
+  bool run() override {
+    internal_order_test();
+    result = kernels::transform_reduce<Op, Policy>(input_, taskData->inputs_count[0]);
+    return true;
+  }
+
+  bool post_processing() override {
+    internal_order_test();
+    auto write = [this](std::size_t k, const auto& value) {
+      reinterpret_cast<std::remove_cvref_t<decltype(value)>*>(taskData->outputs[k])[0] = value;
+    };
+    if constexpr (fused) {
+      std::apply(
+          [&](const auto&... values) {
+            std::size_t k = 0;
+            (write(k++, values), ...);
+          },
+          result);
+    } else {
+      write(0, result);
+    }
+    return true;
+  }
+
+ private:
+  static constexpr bool fused = kernels::detail::is_fused<Op>::value;
+  static constexpr std::size_t outputs = [] {
+    if constexpr (fused) return std::tuple_size_v<typename Op::result_type>;
+    return std::size_t{1};
+  }();
+
+  const InType* input_{};
+  typename Op::result_type result;
+};
+
+}  // namespace reference
+}  // namespace ppc
+
+#endif  // MODULES_REFERENCE_TRANSFORM_REDUCTIONS_REF_TASK_HPP_
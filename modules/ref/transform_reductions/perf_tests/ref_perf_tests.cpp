@@ -0,0 +1,83 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "ref/kernels/perf_tests/perf_utils.hpp"
+#include "ref/transform_reductions/include/ref_task.hpp"
+
+namespace test = ppc::reference::test;
+namespace exec = ppc::reference::exec;
+namespace ops = ppc::reference::kernels::ops;
+
+namespace {
+
+// Sum, extremes and sign changes of the input in one fused pass
+template <class T>
+using Stats = ops::Fused<ops::Sum<T>, ops::Min<T>, ops::Max<T>, ops::CountSignChanges<T>>;
+
+// Outputs of the Reduce task, one per fused operator
+template <class Op>
+constexpr size_t outputs_of = 1;
+template <class... Ops>
+constexpr size_t outputs_of<ops::Fused<Ops...>> = sizeof...(Ops);
+
+template <class Op, class InType, class Policy = exec::seq>
+void measure(size_t count, const std::string& op_name) {
+  // Create data
+  auto in = test::perf_input<InType>(count);
+  std::vector<std::vector<uint8_t>> outputs(outputs_of<Op>, std::vector<uint8_t>(sizeof(uint64_t)));
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  for (auto& out : outputs) {
+    taskData->outputs.emplace_back(out.data());
+    taskData->outputs_count.emplace_back(1);
+  }
+
+  // Create Task
+  auto testTask = std::make_shared<ppc::reference::Reduce<Op, InType, Policy>>(taskData);
+  test::run_perf(testTask, test::case_name<InType, Policy>(count) + "_" + op_name);
+}
+
+}  // namespace
+
+TEST(transform_reductions_perf, test_int16_t) {
+  for (auto count : test::perf_sizes) measure<ops::SumOfSquares<int16_t>, int16_t>(count, "sum_of_squares");
+}
+
+TEST(transform_reductions_perf, test_int8_t) {
+  for (auto count : test::perf_sizes) measure<Stats<int8_t>, int8_t>(count, "stats");
+}
+
+TEST(transform_reductions_perf, test_int32_t) {
+  for (auto count : test::perf_sizes) measure<Stats<int32_t>, int32_t>(count, "stats");
+}
+
+TEST(transform_reductions_perf, test_float) {
+  for (auto count : test::perf_sizes) measure<Stats<float>, float>(count, "stats");
+}
+
+TEST(transform_reductions_perf, test_double) {
+  for (auto count : test::perf_sizes) measure<Stats<double>, double>(count, "stats");
+}
+
+TEST(transform_reductions_perf, test_omp) {
+  measure<Stats<int32_t>, int32_t, exec::omp>(test::perf_backend_size, "stats");
+}
+
+TEST(transform_reductions_perf, test_tbb) {
+  measure<Stats<int32_t>, int32_t, exec::tbb>(test::perf_backend_size, "stats");
+}
+
+TEST(transform_reductions_perf, test_stl) {
+  measure<Stats<int32_t>, int32_t, exec::stl>(test::perf_backend_size, "stats");
+}
+
+TEST(transform_reductions_perf, test_mpi) {
+  measure<Stats<int32_t>, int32_t, exec::mpi>(test::perf_backend_size, "stats");
+}
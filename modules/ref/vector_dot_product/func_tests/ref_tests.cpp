@@ -4,8 +4,44 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "ref/kernels/func_tests/test_utils.hpp"
 #include "ref/vector_dot_product/include/ref_task.hpp"
 
+namespace {
+
+template <class Policy>
+void check_policy_matches_seq() {
+  // Create data
+  const size_t count = 100000;
+  std::vector<int32_t> in1(count), in2(count);
+  for (size_t i = 0; i < count; i++) {
+    in1[i] = static_cast<int32_t>(i % 97) - 48;
+    in2[i] = static_cast<int32_t>(i % 89) - 44;
+  }
+  std::vector<int32_t> out_seq(1, 0), out_par(1, 0);
+
+  auto make_task_data = [&](std::vector<int32_t>& out) {
+    std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in1.data()));
+    taskData->inputs_count.emplace_back(in1.size());
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in2.data()));
+    taskData->inputs_count.emplace_back(in2.size());
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+    taskData->outputs_count.emplace_back(out.size());
+    return taskData;
+  };
+
+  // Create Task
+  ppc::reference::VectorDotProduct<int32_t> seqTask(make_task_data(out_seq));
+  ppc::reference::VectorDotProduct<int32_t, Policy> parTask(make_task_data(out_par));
+  ppc::reference::test::run_task(seqTask);
+  ppc::reference::test::ScopedConcurrency split;
+  ppc::reference::test::run_task(parTask);
+  EXPECT_EQ(out_par, out_seq);
+}
+
+}  // namespace
+
 TEST(vector_dot_product, check_int32_t) {
   // Create data
   const uint64_t count_data = 1256;
@@ -185,3 +221,90 @@ TEST(vector_dot_product, check_float) {
   testTask.post_processing();
   EXPECT_NEAR(out[0], in1.size() * (-1.3f) * 1.2f, 1e-3f);
 }
+
+TEST(vector_dot_product, check_int64_t_exact) {
+  // Create data, the products do not fit into the mantissa of a double
+  std::vector<int64_t> in1 = {(int64_t{1} << 53) + 1, 3};
+  std::vector<int64_t> in2 = {1, 1};
+  std::vector<int64_t> out(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in1.data()));
+  taskData->inputs_count.emplace_back(in1.size());
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in2.data()));
+  taskData->inputs_count.emplace_back(in2.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  ppc::reference::VectorDotProduct<int64_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  ASSERT_EQ(out[0], (int64_t{1} << 53) + 4);
+}
+
+TEST(vector_dot_product, check_float_compensated) {
+  // Create data
+  std::vector<float> in1(10002, 1.f);
+  std::vector<float> in2(10002, 1.f);
+  std::vector<float> out(1, 0.f);
+  in1.front() = 1e8f;
+  in1.back() = -1e8f;
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in1.data()));
+  taskData->inputs_count.emplace_back(in1.size());
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in2.data()));
+  taskData->inputs_count.emplace_back(in2.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  ppc::reference::VectorDotProduct<float, ppc::reference::exec::seq, ppc::reference::kernels::Precision::COMPENSATED>
+      testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  ASSERT_EQ(out[0], 10000.f);
+}
+
+TEST(vector_dot_product, check_omp_matches_seq) { check_policy_matches_seq<ppc::reference::exec::omp>(); }
+
+TEST(vector_dot_product, check_tbb_matches_seq) { check_policy_matches_seq<ppc::reference::exec::tbb>(); }
+
+TEST(vector_dot_product, check_stl_matches_seq) { check_policy_matches_seq<ppc::reference::exec::stl>(); }
+
+TEST(vector_dot_product, check_mpi_matches_seq) { check_policy_matches_seq<ppc::reference::exec::mpi>(); }
+
+TEST(vector_dot_product, check_bfloat16) {
+  // Create data
+  const size_t count = 1000;
+  std::vector<ppc::reference::kernels::bfloat16> in1(count, ppc::reference::kernels::bfloat16(0.5f));
+  std::vector<ppc::reference::kernels::bfloat16> in2(count, ppc::reference::kernels::bfloat16(-3.0f));
+  std::vector<float> out(1, 0.f);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in1.data()));
+  taskData->inputs_count.emplace_back(in1.size());
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in2.data()));
+  taskData->inputs_count.emplace_back(in2.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  ppc::reference::VectorDotProduct<ppc::reference::kernels::bfloat16> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  ASSERT_EQ(out[0], -1.5f * count);
+}
@@ -5,29 +5,26 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
 #include <memory>
-#include <numeric>
-#include <vector>
 
 #include "core/task/include/task.hpp"
+#include "ref/kernels/include/dot.hpp"
+#include "ref/kernels/include/parallel.hpp"
 
 namespace ppc {
 namespace reference {
 
-template <class InOutType>
+// half and bfloat16 inputs give a float result
+template <class InOutType, class Policy = exec::seq, kernels::Precision Mode = kernels::Precision::FAST>
 class VectorDotProduct : public ppc::core::Task {
  public:
   explicit VectorDotProduct(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(taskData_) {}
   bool pre_processing() override {
     internal_order_test();
-    // Init vectors
-    input_ = std::vector<std::vector<InOutType> >(2);
+    // Init inputs, the kernels read them in place
     for (size_t i = 0; i < input_.size(); i++) {
-      input_[i] = std::vector<InOutType>(taskData->inputs_count[i]);
-      auto tmp_ptr_ = reinterpret_cast<InOutType*>(taskData->inputs[i]);
-      for (unsigned j = 0; j < taskData->inputs_count[i]; j++) {
-        input_[i][j] = tmp_ptr_[j];
-      }
+      input_[i] = reinterpret_cast<InOutType*>(taskData->inputs[i]);
     }
 
     // Init value for output
@@ -43,19 +40,19 @@ class VectorDotProduct : public ppc::core::Task {
 
   bool run() override {
     internal_order_test();
-    dor_product = std::inner_product(input_[0].begin(), input_[0].end(), input_[1].begin(), 0.0);
+    dor_product = kernels::dot<Mode, Policy>(input_[0], input_[1], taskData->inputs_count[0]);
     return true;
   }
 
   bool post_processing() override {
     internal_order_test();
-    reinterpret_cast<InOutType*>(taskData->outputs[0])[0] = dor_product;
+    reinterpret_cast<kernels::compute_t<InOutType>*>(taskData->outputs[0])[0] = dor_product;
     return true;
   }
 
  private:
-  std::vector<std::vector<InOutType> > input_;
-  InOutType dor_product;
+  std::array<const InOutType*, 2> input_{};
+  kernels::compute_t<InOutType> dor_product;
 };
 
 }  // namespace reference
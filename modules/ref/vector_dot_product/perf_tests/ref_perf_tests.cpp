@@ -0,0 +1,75 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "ref/kernels/perf_tests/perf_utils.hpp"
+#include "ref/vector_dot_product/include/ref_task.hpp"
+
+namespace test = ppc::reference::test;
+namespace exec = ppc::reference::exec;
+using ppc::reference::kernels::Precision;
+
+namespace {
+
+template <class InOutType, class Policy = exec::seq, Precision Mode = Precision::FAST>
+void measure(size_t count) {
+  // Create data
+  auto in1 = test::perf_input<InOutType>(count, 1);
+  auto in2 = test::perf_input<InOutType>(count, 2);
+  std::vector<ppc::reference::kernels::compute_t<InOutType>> out(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in1.data()));
+  taskData->inputs_count.emplace_back(in1.size());
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in2.data()));
+  taskData->inputs_count.emplace_back(in2.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto testTask = std::make_shared<ppc::reference::VectorDotProduct<InOutType, Policy, Mode>>(taskData);
+  const std::string suffix = Mode == Precision::COMPENSATED ? "_compensated" : "";
+  test::run_perf(testTask, test::case_name<InOutType, Policy>(count) + suffix);
+}
+
+}  // namespace
+
+TEST(vector_dot_product_perf, test_int8_t) {
+  for (auto count : test::perf_sizes) measure<int8_t>(count);
+}
+
+TEST(vector_dot_product_perf, test_int32_t) {
+  for (auto count : test::perf_sizes) measure<int32_t>(count);
+}
+
+TEST(vector_dot_product_perf, test_int64_t) {
+  for (auto count : test::perf_sizes) measure<int64_t>(count);
+}
+
+TEST(vector_dot_product_perf, test_bfloat16) {
+  for (auto count : test::perf_sizes) measure<ppc::reference::kernels::bfloat16>(count);
+}
+
+TEST(vector_dot_product_perf, test_float) {
+  for (auto count : test::perf_sizes) measure<float>(count);
+}
+
+TEST(vector_dot_product_perf, test_float_compensated) {
+  for (auto count : test::perf_sizes) measure<float, exec::seq, Precision::COMPENSATED>(count);
+}
+
+TEST(vector_dot_product_perf, test_double) {
+  for (auto count : test::perf_sizes) measure<double>(count);
+}
+
+TEST(vector_dot_product_perf, test_omp) { measure<int32_t, exec::omp>(test::perf_backend_size); }
+
+TEST(vector_dot_product_perf, test_tbb) { measure<int32_t, exec::tbb>(test::perf_backend_size); }
+
+TEST(vector_dot_product_perf, test_stl) { measure<int32_t, exec::stl>(test::perf_backend_size); }
+
+TEST(vector_dot_product_perf, test_mpi) { measure<int32_t, exec::mpi>(test::perf_backend_size); }
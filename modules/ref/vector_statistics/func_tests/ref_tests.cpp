@@ -0,0 +1,202 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "ref/kernels/func_tests/test_utils.hpp"
+#include "ref/vector_statistics/include/ref_task.hpp"
+
+using ppc::reference::Statistic;
+
+namespace {
+
+// Integer statistics are exact, so every backend has to match seq bit for bit
+template <class Policy>
+void check_policy_matches_seq() {
+  // Create data
+  const size_t count = 100000;
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int32_t> dist(-1000, 1000);
+  std::vector<int32_t> in(count);
+  for (auto& elem : in) elem = dist(gen);
+  const std::vector<Statistic> layout = {Statistic::SUM, Statistic::MIN_INDEX, Statistic::MAX_INDEX,
+                                         Statistic::SIGN_ALTERNATIONS};
+  std::vector<std::vector<int64_t>> out_seq(layout.size(), std::vector<int64_t>(1)), out_par = out_seq;
+
+  auto make_task_data = [&](std::vector<std::vector<int64_t>>& outputs) {
+    std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+    taskData->inputs_count.emplace_back(in.size());
+    for (auto& out : outputs) {
+      taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+      taskData->outputs_count.emplace_back(out.size());
+    }
+    return taskData;
+  };
+
+  // Create Task
+  ppc::reference::VectorStatistics<int32_t, int64_t> seqTask(make_task_data(out_seq), layout);
+  ppc::reference::VectorStatistics<int32_t, int64_t, Policy> parTask(make_task_data(out_par), layout);
+  ppc::reference::test::run_task(seqTask);
+  ppc::reference::test::ScopedConcurrency split;
+  ppc::reference::test::run_task(parTask);
+  EXPECT_EQ(out_par, out_seq);
+}
+
+}  // namespace
+
+TEST(vector_statistics, check_int32_t) {
+  // Create data
+  std::vector<int32_t> in = {3, -1, 4, -1, 5, -9, 2, 6};
+  std::vector<int64_t> sum(1, 0);
+  std::vector<double> mean(1, 0), variance(1, 0);
+  std::vector<int32_t> min(1, 0), max(1, 0);
+  std::vector<uint64_t> min_index(1, 0), max_index(1, 0), alternations(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  for (auto* out : {reinterpret_cast<uint8_t*>(sum.data()), reinterpret_cast<uint8_t*>(mean.data()),
+                    reinterpret_cast<uint8_t*>(min.data()), reinterpret_cast<uint8_t*>(min_index.data()),
+                    reinterpret_cast<uint8_t*>(max.data()), reinterpret_cast<uint8_t*>(max_index.data()),
+                    reinterpret_cast<uint8_t*>(variance.data()), reinterpret_cast<uint8_t*>(alternations.data())}) {
+    taskData->outputs.emplace_back(out);
+    taskData->outputs_count.emplace_back(1);
+  }
+
+  // Create Task
+  ppc::reference::VectorStatistics<int32_t, uint64_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  ASSERT_EQ(sum[0], 9);
+  EXPECT_NEAR(mean[0], 1.125, 1e-12);
+  ASSERT_EQ(min[0], -9);
+  ASSERT_EQ(min_index[0], 5ull);
+  ASSERT_EQ(max[0], 6);
+  ASSERT_EQ(max_index[0], 7ull);
+  EXPECT_NEAR(variance[0], 20.359375, 1e-9);
+  ASSERT_EQ(alternations[0], 6ull);
+}
+
+TEST(vector_statistics, check_validate_func) {
+  // Create data
+  std::vector<int32_t> in(125, 1);
+  std::vector<int64_t> out(2, 0);
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+  // Create Task
+  ppc::reference::VectorStatistics<int32_t, uint64_t> testTask(taskData, {Statistic::SUM});
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, false);
+}
+
+TEST(vector_statistics, check_custom_layout) {
+  // Create data
+  std::vector<double> in(1000);
+  for (size_t i = 0; i < in.size(); i++) {
+    in[i] = static_cast<double>(i % 10);
+  }
+  std::vector<double> max(1, 0), mean(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(max.data()));
+  taskData->outputs_count.emplace_back(max.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(mean.data()));
+  taskData->outputs_count.emplace_back(mean.size());
+
+  // Create Task
+  ppc::reference::VectorStatistics<double, uint64_t> testTask(taskData, {Statistic::MAX, Statistic::MEAN});
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  EXPECT_EQ(max[0], 9.0);
+  EXPECT_NEAR(mean[0], 4.5, 1e-12);
+}
+
+TEST(vector_statistics, check_int8_t) {
+  // Create data
+  std::vector<int8_t> in(100000, -128);
+  for (size_t i = 0; i < in.size(); i += 2) {
+    in[i] = 127;
+  }
+  std::vector<int64_t> sum(1, 0);
+  std::vector<double> variance(1, 0);
+  std::vector<uint64_t> alternations(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(sum.data()));
+  taskData->outputs_count.emplace_back(sum.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(variance.data()));
+  taskData->outputs_count.emplace_back(variance.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(alternations.data()));
+  taskData->outputs_count.emplace_back(alternations.size());
+
+  // Create Task
+  ppc::reference::VectorStatistics<int8_t, uint64_t> testTask(
+      taskData, {Statistic::SUM, Statistic::VARIANCE, Statistic::SIGN_ALTERNATIONS});
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  ASSERT_EQ(sum[0], -50000);
+  EXPECT_NEAR(variance[0], 127.5 * 127.5, 1e-6);
+  ASSERT_EQ(alternations[0], in.size() - 1);
+}
+
+TEST(vector_statistics, check_float_stl_matches_seq) {
+  // Create data
+  std::vector<float> in(200000);
+  for (size_t i = 0; i < in.size(); i++) {
+    in[i] = static_cast<float>(static_cast<int>(i * 7919 % 2001) - 1000) / 8.f;
+  }
+  std::vector<float> min_seq(1, 0), min_par(1, 0);
+  std::vector<uint64_t> alternations_seq(1, 0), alternations_par(1, 0);
+
+  auto make_task_data = [&](std::vector<float>& min, std::vector<uint64_t>& alternations) {
+    std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+    taskData->inputs_count.emplace_back(in.size());
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(min.data()));
+    taskData->outputs_count.emplace_back(min.size());
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(alternations.data()));
+    taskData->outputs_count.emplace_back(alternations.size());
+    return taskData;
+  };
+
+  // Create Task
+  ppc::reference::VectorStatistics<float, uint64_t> seqTask(make_task_data(min_seq, alternations_seq),
+                                                            {Statistic::MIN, Statistic::SIGN_ALTERNATIONS});
+  ppc::reference::VectorStatistics<float, uint64_t, ppc::reference::exec::stl> parTask(
+      make_task_data(min_par, alternations_par), {Statistic::MIN, Statistic::SIGN_ALTERNATIONS});
+  ppc::reference::test::run_task(seqTask);
+  ppc::reference::test::run_task(parTask);
+  EXPECT_EQ(min_par, min_seq);
+  EXPECT_EQ(alternations_par, alternations_seq);
+}
+
+TEST(vector_statistics, check_omp_matches_seq) { check_policy_matches_seq<ppc::reference::exec::omp>(); }
+
+TEST(vector_statistics, check_tbb_matches_seq) { check_policy_matches_seq<ppc::reference::exec::tbb>(); }
+
+TEST(vector_statistics, check_stl_matches_seq) { check_policy_matches_seq<ppc::reference::exec::stl>(); }
+
+TEST(vector_statistics, check_mpi_matches_seq) { check_policy_matches_seq<ppc::reference::exec::mpi>(); }
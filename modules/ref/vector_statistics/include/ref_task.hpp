@@ -0,0 +1,114 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_VECTOR_STATISTICS_REF_TASK_HPP_
+#define MODULES_REFERENCE_VECTOR_STATISTICS_REF_TASK_HPP_
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "ref/kernels/include/accumulator.hpp"
+#include "ref/kernels/include/parallel.hpp"
+#include "ref/kernels/include/statistics.hpp"
+
+namespace ppc {
+namespace reference {
+
+// Statistics VectorStatistics can write, each into its own output of one
+// element of the listed type
+enum class Statistic {
+  SUM,                // kernels::accumulator_t<InType>
+  MEAN,               // double
+  MIN,                // InType
+  MIN_INDEX,          // IndexType
+  MAX,                // InType
+  MAX_INDEX,          // IndexType
+  VARIANCE,           // double, population variance
+  SIGN_ALTERNATIONS,  // IndexType
+};
+
+// Computes all statistics in one scan of the input. The layout lists the
+// statistic written to each output, in the order of taskData->outputs.
+template <class InType, class IndexType, class Policy = exec::seq>
+class VectorStatistics : public ppc::core::Task {
+ public:
+  explicit VectorStatistics(std::shared_ptr<ppc::core::TaskData> taskData_,
+                            std::vector<Statistic> layout_ = {Statistic::SUM, Statistic::MEAN, Statistic::MIN,
+                                                              Statistic::MIN_INDEX, Statistic::MAX,
+                                                              Statistic::MAX_INDEX, Statistic::VARIANCE,
+                                                              Statistic::SIGN_ALTERNATIONS})
+      : Task(taskData_), layout(std::move(layout_)) {}
+  bool pre_processing() override {
+    internal_order_test();
+    // Init input, the kernels read it in place
+    input_ = reinterpret_cast<InType*>(taskData->inputs[0]);
+    // Init value for output
+    stats = {};
+    return true;
+  }
+
+  bool validation() override {
+    internal_order_test();
+    // Check count elements of output
+    if (layout.empty() || taskData->outputs.size() != layout.size() || taskData->inputs_count[0] == 0) {
+      return false;
+    }
+    for (auto count : taskData->outputs_count) {
+      if (count != 1) return false;
+    }
+    return true;
+  }
+
+  bool run() override {
+    internal_order_test();
+    stats = kernels::statistics<Policy>(input_, taskData->inputs_count[0]);
+    return true;
+  }
+
+  bool post_processing() override {
+    internal_order_test();
+    for (size_t i = 0; i < layout.size(); i++) {
+      auto* out = taskData->outputs[i];
+      switch (layout[i]) {
+        case Statistic::SUM:
+          reinterpret_cast<kernels::accumulator_t<InType>*>(out)[0] = stats.sum;
+          break;
+        case Statistic::MEAN:
+          reinterpret_cast<double*>(out)[0] = stats.mean;
+          break;
+        case Statistic::MIN:
+          reinterpret_cast<InType*>(out)[0] = stats.min.value;
+          break;
+        case Statistic::MIN_INDEX:
+          reinterpret_cast<IndexType*>(out)[0] = static_cast<IndexType>(stats.min.index);
+          break;
+        case Statistic::MAX:
+          reinterpret_cast<InType*>(out)[0] = stats.max.value;
+          break;
+        case Statistic::MAX_INDEX:
+          reinterpret_cast<IndexType*>(out)[0] = static_cast<IndexType>(stats.max.index);
+          break;
+        case Statistic::VARIANCE:
+          reinterpret_cast<double*>(out)[0] = stats.variance();
+          break;
+        case Statistic::SIGN_ALTERNATIONS:
+          reinterpret_cast<IndexType*>(out)[0] = static_cast<IndexType>(stats.sign_changes);
+          break;
+      }
+    }
+    return true;
+  }
+
+ private:
+  std::vector<Statistic> layout;
+  const InType* input_{};
+  kernels::Statistics<InType> stats;
+};
+
+}  // namespace reference
+}  // namespace ppc
+
+#endif  // MODULES_REFERENCE_VECTOR_STATISTICS_REF_TASK_HPP_
@@ -16,14 +16,27 @@ list_of_type_of_tasks = ["mpi", "omp", "seq", "stl", "tbb"]
 result_tables = {"pipeline": {}, "task_run": {}}
 set_of_task_name = []
 
+
+# tasks/<type>/<task>:<perf type>:<time> for the student's tasks and
+# modules/ref/<task>/<type>/<case>:<perf type>:<time> for the reference ones,
+# whose cases are listed as <task>/<case>
+def parse_perf_line(line):
+    result = re.findall(r'tasks[\/|\\](\w*)[\/|\\](\w*):(\w*):(-*\d*\.\d*)', line)
+    if len(result):
+        return result[0][0], result[0][1], result[0][2], float(result[0][3])
+    result = re.findall(r'modules[\/|\\]ref[\/|\\](\w*)[\/|\\](\w*)[\/|\\](\w*):(\w*):(-*\d*\.\d*)', line)
+    if len(result):
+        return result[0][1], result[0][0] + "/" + result[0][2], result[0][3], float(result[0][4])
+    return None
+
+
 logs_file = open(logs_path, "r")
 logs_lines = logs_file.readlines()
 for line in logs_lines:
-    pattern = r'tasks[\/|\\](\w*)[\/|\\](\w*):(\w*):(-*\d*\.\d*)'
-    result = re.findall(pattern, line)
-    if len(result):
-        task_name = result[0][1]
-        perf_type = result[0][2]
+    result = parse_perf_line(line)
+    if result:
+        task_name = result[1]
+        perf_type = result[2]
         set_of_task_name.append(task_name)
         result_tables[perf_type][task_name] = {}
 
@@ -31,13 +44,9 @@ for line in logs_lines:
             result_tables[perf_type][task_name][ttype] = -1.0
 
 for line in logs_lines:
-    pattern = r'tasks[\/|\\](\w*)[\/|\\](\w*):(\w*):(-*\d*\.\d*)'
-    result = re.findall(pattern, line)
-    if len(result):
-        task_type = result[0][0]
-        task_name = result[0][1]
-        perf_type = result[0][2]
-        perf_time = float(result[0][3])
+    result = parse_perf_line(line)
+    if result:
+        task_type, task_name, perf_type, perf_time = result
         result_tables[perf_type][task_name][task_type] = perf_time
 
 
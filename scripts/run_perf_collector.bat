@@ -1,5 +1,7 @@
 REM mpiexec -np 4 build\bin\mpi_perf_tests.exe
+build\bin\core_perf_tests.exe
 build\bin\omp_perf_tests.exe
+build\bin\ref_perf_tests.exe
 build\bin\seq_perf_tests.exe
 build\bin\stl_perf_tests.exe
 build\bin\tbb_perf_tests.exe
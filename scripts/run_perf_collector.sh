@@ -7,7 +7,9 @@ if [[ -z "$ASAN_RUN" ]]; then
     mpirun -np 2 ./build/bin/mpi_perf_tests
   fi
 fi
+./build/bin/core_perf_tests
 ./build/bin/omp_perf_tests
+./build/bin/ref_perf_tests
 ./build/bin/seq_perf_tests
 ./build/bin/stl_perf_tests
 ./build/bin/tbb_perf_tests
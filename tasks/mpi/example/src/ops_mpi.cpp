@@ -2,12 +2,16 @@
 #include "mpi/example/include/ops_mpi.hpp"
 
 #include <algorithm>
+#include <cstddef>
 #include <functional>
+#include <limits>
 #include <random>
 #include <string>
 #include <thread>
 #include <vector>
 
+#include "core/partition/include/partition.hpp"
+
 using namespace std::chrono_literals;
 
 std::vector<int> getRandomVector(int sz) {
@@ -59,11 +63,13 @@ bool TestMPITaskSequential::post_processing() {
 
 bool TestMPITaskParallel::pre_processing() {
   internal_order_test();
-  unsigned int delta = 0;
+  unsigned int count = 0;
   if (world.rank() == 0) {
-    delta = taskData->inputs_count[0] / world.size();
+    count = taskData->inputs_count[0];
   }
-  broadcast(world, delta, 0);
+  broadcast(world, count, 0);
+  // every element goes to exactly one process, the remainder to the first ones
+  const auto ranges = ppc::core::balanced_partition(count, world.size());
 
   if (world.rank() == 0) {
     // Init vectors
@@ -73,14 +79,16 @@ bool TestMPITaskParallel::pre_processing() {
       input_[i] = tmp_ptr[i];
     }
     for (int proc = 1; proc < world.size(); proc++) {
-      world.send(proc, 0, input_.data() + proc * delta, delta);
+      const auto& range = ranges[proc];
+      world.send(proc, 0, input_.data() + range.begin, static_cast<int>(range.size()));
     }
   }
-  local_input_ = std::vector<int>(delta);
+  const auto& own = ranges[world.rank()];
+  local_input_ = std::vector<int>(own.size());
   if (world.rank() == 0) {
-    local_input_ = std::vector<int>(input_.begin(), input_.begin() + delta);
+    local_input_ = std::vector<int>(input_.begin(), input_.begin() + static_cast<std::ptrdiff_t>(own.end));
   } else {
-    world.recv(0, 0, local_input_.data(), delta);
+    world.recv(0, 0, local_input_.data(), static_cast<int>(own.size()));
   }
   // Init value for output
   res = 0;
@@ -104,7 +112,9 @@ bool TestMPITaskParallel::run() {
   } else if (ops == "-") {
     local_res = -std::accumulate(local_input_.begin(), local_input_.end(), 0);
   } else if (ops == "max") {
-    local_res = *std::max_element(local_input_.begin(), local_input_.end());
+    // a process gets no elements when there are fewer elements than processes
+    local_res = local_input_.empty() ? std::numeric_limits<int>::min()
+                                     : *std::max_element(local_input_.begin(), local_input_.end());
   }
 
   if (ops == "+" || ops == "-") {
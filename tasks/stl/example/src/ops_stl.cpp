@@ -1,7 +1,8 @@
 // Copyright 2023 Nesterov Alexander
 #include "stl/example/include/ops_stl.hpp"
 
-#include <future>
+#include <algorithm>
+#include <cstddef>
 #include <iostream>
 #include <numeric>
 #include <random>
@@ -10,6 +11,9 @@
 #include <utility>
 #include <vector>
 
+#include "core/partition/include/partition.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
 using namespace std::chrono_literals;
 
 std::vector<int> getRandomVector(int sz) {
@@ -58,25 +62,27 @@ bool TestSTLTaskSequential::post_processing() {
   return true;
 }
 
-std::mutex my_mutex;
+namespace {
+
+// A partial result per thread on its own cache line, so the threads never
+// write to a line another thread is using
+struct alignas(64) Partial {
+  int value = 0;
+};
 
-void atomOps(std::vector<int> vec, const std::string &ops, std::promise<int> &&pr) {
-  auto sz = vec.size();
+// Reduction of [begin, end) into a local variable, without locks
+int reduce_range(const int *begin, const int *end, const std::string &ops) {
   int reduction_elem = 0;
   if (ops == "+") {
-    for (size_t i = 0; i < sz; i++) {
-      std::lock_guard<std::mutex> my_lock(my_mutex);
-      reduction_elem += vec[i];
-    }
+    for (const int *it = begin; it != end; it++) reduction_elem += *it;
   } else if (ops == "-") {
-    for (size_t i = 0; i < sz; i++) {
-      std::lock_guard<std::mutex> my_lock(my_mutex);
-      reduction_elem -= vec[i];
-    }
+    for (const int *it = begin; it != end; it++) reduction_elem -= *it;
   }
-  pr.set_value(reduction_elem);
+  return reduction_elem;
 }
 
+}  // namespace
+
 bool TestSTLTaskParallel::pre_processing() {
   internal_order_test();
   // Init vectors
@@ -98,24 +104,17 @@ bool TestSTLTaskParallel::validation() {
 
 bool TestSTLTaskParallel::run() {
   internal_order_test();
-  const auto nthreads = std::thread::hardware_concurrency();
-  const auto delta = (input_.end() - input_.begin()) / nthreads;
-
-  auto *promises = new std::promise<int>[nthreads];
-  auto *futures = new std::future<int>[nthreads];
-  auto *threads = new std::thread[nthreads];
-
-  for (unsigned i = 0; i < nthreads; i++) {
-    futures[i] = promises[i].get_future();
-    std::vector<int> tmp_vec(input_.begin() + i * delta, input_.begin() + (i + 1) * delta);
-    threads[i] = std::thread(atomOps, tmp_vec, ops, std::move(promises[i]));
-    threads[i].join();
-    res += futures[i].get();
-  }
-
-  delete[] promises;
-  delete[] futures;
-  delete[] threads;
+  const std::size_t nthreads = std::max(std::thread::hardware_concurrency(), 1U);
+  // ranges of whole cache lines, the remainder goes to the first threads
+  const auto ranges = ppc::core::balanced_partition(input_.size(), nthreads, ppc::core::cache_line_elements<int>());
+
+  // every thread reduces its part concurrently, the partials are combined
+  // once all are done; the workers of the shared pool outlive the task
+  std::vector<Partial> partial(nthreads);
+  ppc::core::ThreadPool::instance().parallel_for(nthreads, [&](std::size_t i) {
+    partial[i].value = reduce_range(input_.data() + ranges[i].begin, input_.data() + ranges[i].end, ops);
+  });
+  for (const auto &p : partial) res += p.value;
   return true;
 }
 